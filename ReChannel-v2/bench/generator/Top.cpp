@@ -0,0 +1,166 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    Top.cpp
+ * @brief   Top module of the design generator.
+ */
+
+#include <sys/time.h>
+
+#include <iostream>
+
+#include "Top.h"
+
+// returns the wall-clock time in seconds
+static double wall_time()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+Top::Top(sc_module_name name_,
+    int region_count_, int alternative_count_, int lane_count,
+    int filter_count, int round_count_)
+    : sc_module(name_), ctrl("ctrl"),
+      region_count(region_count_), alternative_count(alternative_count_),
+      round_count(round_count_)
+{
+    for (int r=0; r < region_count; ++r) {
+        // the alternatives of the region
+        rc_reconfigurable_set region_set;
+        for (int a=0; a < alternative_count; ++a) {
+            Alternative_rc* alternative = new Alternative_rc(
+                sc_gen_unique_name("alternative"),
+                lane_count, filter_count);
+            region_set.insert(*alternative);
+            alternatives.push_back(alternative);
+        }
+        // the lanes of the region
+        for (int l=0; l < lane_count; ++l) {
+            sc_fifo<int>* in_fifo =
+                new sc_fifo<int>(sc_gen_unique_name("in_fifo"), 1);
+            sc_fifo<int>* out_fifo =
+                new sc_fifo<int>(sc_gen_unique_name("out_fifo"), 1);
+            rc_portal<sc_fifo_in<int> >* in_portal =
+                new rc_portal<sc_fifo_in<int> >(
+                    sc_gen_unique_name("in_portal"));
+            rc_portal<sc_fifo_out<int> >* out_portal =
+                new rc_portal<sc_fifo_out<int> >(
+                    sc_gen_unique_name("out_portal"));
+            laneChannelMap* channel_map =
+                new laneChannelMap(*in_fifo, *out_fifo);
+            rc_switch_connector<lanePortMap>* connector =
+                new rc_switch_connector<lanePortMap>(
+                    sc_gen_unique_name("connector"),
+                    *in_portal, *out_portal);
+
+            connector->bind_static(*channel_map);
+            for (int a=0; a < alternative_count; ++a) {
+                Alternative_rc& alternative =
+                    *alternatives[r * alternative_count + a];
+                connector->bind_dynamic(alternative.get_portmap(l));
+            }
+
+            channels.push_back(in_fifo);
+            channels.push_back(out_fifo);
+            channel_maps.push_back(channel_map);
+            in_portals.push_back(in_portal);
+            out_portals.push_back(out_portal);
+            connectors.push_back(connector);
+        }
+        ctrl.add(region_set);
+    }
+
+    SC_THREAD(swap_proc);
+}
+
+int Top::get_filter_count() const
+{
+    int filter_count = 0;
+    for (unsigned int i=0; i < alternatives.size(); ++i) {
+        filter_count += alternatives[i]->get_filter_count();
+    }
+    return filter_count;
+}
+
+Top::~Top()
+{
+    for (unsigned int i=0; i < alternatives.size(); ++i) {
+        delete alternatives[i];
+    }
+    for (unsigned int i=0; i < connectors.size(); ++i) {
+        delete connectors[i];
+        delete channel_maps[i];
+        delete in_portals[i];
+        delete out_portals[i];
+    }
+    for (unsigned int i=0; i < channels.size(); ++i) {
+        delete channels[i];
+    }
+}
+
+void Top::swap_proc()
+{
+    if (alternative_count == 0) {
+        return;
+    }
+
+    // initially the first alternative of each region is active
+    rc_reconfigurable_set initial_set;
+    for (int r=0; r < region_count; ++r) {
+        initial_set.insert(*alternatives[r * alternative_count]);
+    }
+    ctrl.activate(initial_set);
+
+    // each round swaps every region to its next alternative
+    const double begin = wall_time();
+    for (int i=0; i < round_count; ++i) {
+        for (int r=0; r < region_count; ++r) {
+            Alternative_rc& current =
+                *alternatives[r * alternative_count
+                    + i % alternative_count];
+            Alternative_rc& next =
+                *alternatives[r * alternative_count
+                    + (i + 1) % alternative_count];
+            ctrl.unload(current);
+            ctrl.activate(next);
+        }
+    }
+    const double seconds = wall_time() - begin;
+
+    const double swap_count = (double)round_count * region_count;
+    std::cout << "swaps:              " << swap_count << std::endl;
+    if (swap_count > 0.0 && seconds > 0.0) {
+        std::cout << "swap throughput:    " << swap_count / seconds
+                  << " swaps/s" << std::endl;
+        std::cout << "swap latency:       "
+                  << seconds / swap_count * 1000000.0
+                  << " us (wall clock)" << std::endl;
+    }
+    sc_stop();
+}
+
+//
+// $Id$
+//
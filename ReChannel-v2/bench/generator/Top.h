@@ -0,0 +1,88 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    Top.h
+ * @brief   Top module of the design generator.
+ */
+
+#ifndef TOP_H_
+#define TOP_H_
+
+#include <vector>
+
+#include <systemc.h>
+#include <ReChannel.h>
+
+#include "modules.h"
+
+/* The generated design consists of a number of independent regions.
+ * Each region has its own portals and a number of alternative modules,
+ * of which one is active at a time.
+ */
+SC_MODULE(Top)
+{
+    SC_HAS_PROCESS(Top);
+
+    Top(sc_module_name name_,
+        int region_count, int alternative_count, int lane_count,
+        int filter_count, int round_count);
+
+    ~Top();
+
+    // returns the number of portals
+    int get_portal_count() const
+        { return (int)in_portals.size() + (int)out_portals.size(); }
+
+    // returns the number of reconfigurable modules
+    int get_module_count() const
+        { return (int)alternatives.size(); }
+
+    // returns the number of filters added to the modules
+    int get_filter_count() const;
+
+private:
+
+    void swap_proc();
+
+private:
+
+    rc_control ctrl;
+
+    int region_count;
+    int alternative_count;
+    int round_count;
+
+    std::vector<sc_fifo<int>*>                   channels;
+    std::vector<laneChannelMap*>                 channel_maps;
+    std::vector<rc_portal<sc_fifo_in<int> >*>    in_portals;
+    std::vector<rc_portal<sc_fifo_out<int> >*>   out_portals;
+    std::vector<rc_switch_connector<lanePortMap>*> connectors;
+    // alternative a of region r is at index r * alternative_count + a
+    std::vector<Alternative_rc*>                 alternatives;
+};
+
+#endif // TOP_H_
+
+//
+// $Id$
+//
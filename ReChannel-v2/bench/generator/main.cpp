@@ -0,0 +1,125 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    main.cpp
+ * @brief   Main C++ file of benchmark project 'generator'.
+ *
+ * The generator builds a synthetic design of N regions with M
+ * alternative modules each. Every module has P portals (in lanes of an
+ * input and an output portal) with F filters per portal. It reports the
+ * elaboration time, the peak memory usage, the object counts and the
+ * reconfiguration throughput of the design.
+ *
+ * Usage: generator.x [N [M [P [F [rounds]]]]]
+ */
+
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include <cstdlib>
+#include <iostream>
+
+#include <systemc.h>
+
+#include "Top.h"
+
+// returns the wall-clock time in seconds
+static double wall_time()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+// returns the peak resident set size in KB
+static long peak_rss()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// counts the given objects and all of their descendants
+static int count_objects(const std::vector<sc_object*>& objects)
+{
+    int count = objects.size();
+    for (unsigned int i=0; i < objects.size(); ++i) {
+        count += count_objects(objects[i]->get_child_objects());
+    }
+    return count;
+}
+
+static int get_arg(int argc, char* argv[], int index, int default_value)
+{
+    return (argc > index ? std::atoi(argv[index]) : default_value);
+}
+
+int sc_main(int argc, char* argv[])
+{
+    const int region_count      = get_arg(argc, argv, 1, 4);
+    const int alternative_count = get_arg(argc, argv, 2, 4);
+    const int portal_count      = get_arg(argc, argv, 3, 4);
+    const int filter_count      = get_arg(argc, argv, 4, 0);
+    const int round_count       = get_arg(argc, argv, 5, 100);
+
+    // portals come in lanes of an input and an output portal
+    const int lane_count = (portal_count + 1) / 2;
+
+    std::cout << "regions:            " << region_count << std::endl;
+    std::cout << "alternatives:       " << alternative_count << std::endl;
+    std::cout << "portals per region: " << 2 * lane_count << std::endl;
+    std::cout << "filters per portal: " << filter_count << std::endl;
+
+    const double begin = wall_time();
+    Top* top = new Top("top", region_count, alternative_count,
+        lane_count, filter_count, round_count);
+    const double construction_time = wall_time() - begin;
+    // complete the elaboration and initialise the simulation
+    sc_start(SC_ZERO_TIME);
+    const double elaboration_time = wall_time() - begin;
+
+    std::cout << "construction time:  "
+              << construction_time << " s" << std::endl;
+    std::cout << "elaboration time:   "
+              << elaboration_time << " s" << std::endl;
+    std::cout << "peak RSS:           " << peak_rss() << " KB" << std::endl;
+    std::cout << "modules:            "
+              << top->get_module_count() << std::endl;
+    std::cout << "portals:            "
+              << top->get_portal_count() << std::endl;
+    std::cout << "filters:            "
+              << top->get_filter_count() << std::endl;
+    std::cout << "sc_objects:         "
+              << count_objects(sc_get_top_level_objects()) << std::endl;
+
+    sc_start();
+
+    std::cout << "peak RSS:           " << peak_rss() << " KB" << std::endl;
+
+    delete top;
+    return 0;
+}
+
+//
+// $Id$
+//
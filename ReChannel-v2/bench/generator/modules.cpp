@@ -0,0 +1,83 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    modules.cpp
+ * @brief   Reconfigurable module of the design generator.
+ */
+
+#include "modules.h"
+
+Alternative_rc::Alternative_rc(
+    const sc_module_name& name_, int lane_count, int filter_count)
+    : rc_reconfigurable_module<>(name_)
+{
+    for (int i=0; i < lane_count; ++i) {
+        rc_fifo_in<int>* in = new rc_fifo_in<int>(
+            sc_gen_unique_name("in"));
+        rc_fifo_out<int>* out = new rc_fifo_out<int>(
+            sc_gen_unique_name("out"));
+        lanePortMap* portmap = new lanePortMap(*in, *out);
+        this->rc_add_portmap(*portmap);
+        for (int j=0; j < filter_count; ++j) {
+            rc_fifo_in_filter<int>* in_filter =
+                new rc_fifo_in_filter<int>();
+            rc_fifo_out_filter<int>* out_filter =
+                new rc_fifo_out_filter<int>();
+            this->rc_add_filter(*in, *in_filter);
+            this->rc_add_filter(*out, *out_filter);
+            in_filters.push_back(in_filter);
+            out_filters.push_back(out_filter);
+        }
+        in_ports.push_back(in);
+        out_ports.push_back(out);
+        portmaps.push_back(portmap);
+    }
+    if (lane_count > 0) {
+        RC_THREAD(proc);
+    }
+}
+
+Alternative_rc::~Alternative_rc()
+{
+    for (unsigned int i=0; i < in_filters.size(); ++i) {
+        delete in_filters[i];
+        delete out_filters[i];
+    }
+    for (unsigned int i=0; i < portmaps.size(); ++i) {
+        delete portmaps[i];
+        delete in_ports[i];
+        delete out_ports[i];
+    }
+}
+
+void Alternative_rc::proc()
+{
+    while(true) {
+        int value = in_ports[0]->read();
+        out_ports[0]->write(value);
+    }
+}
+
+//
+// $Id$
+//
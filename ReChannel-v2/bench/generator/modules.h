@@ -0,0 +1,93 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    modules.h
+ * @brief   Reconfigurable module of the design generator.
+ */
+
+#ifndef MODULES_H_
+#define MODULES_H_
+
+#include <vector>
+
+#include <systemc.h>
+#include <ReChannel.h>
+
+// The port map of a lane (a pair of portals):
+
+RC_PORTMAP(
+    lanePortMap, 2,
+    RC_PORT_TYPES(
+        sc_fifo_in<int>,
+        sc_fifo_out<int>
+    )
+);
+
+// The port map of a lane's static channels:
+
+RC_PORTMAP(
+    laneChannelMap, 2,
+    RC_PORT_TYPES(
+        sc_fifo<int>,
+        sc_fifo<int>
+    )
+);
+
+/* Module 'Alternative_rc' is one of the alternatives of a region. It
+ * possesses a port map per lane and a chain of filters per port. Its
+ * thread passes the data of lane 0 through.
+ */
+RC_RECONFIGURABLE_MODULE(Alternative_rc)
+{
+    RC_HAS_PROCESS(Alternative_rc);
+
+    Alternative_rc(
+        const sc_module_name& name_, int lane_count, int filter_count);
+
+    ~Alternative_rc();
+
+    int get_lane_count() const
+        { return (int)portmaps.size(); }
+
+    lanePortMap& get_portmap(int lane)
+        { return *portmaps[lane]; }
+
+    int get_filter_count() const
+        { return (int)in_filters.size() + (int)out_filters.size(); }
+
+private:
+    void proc();
+
+private:
+    std::vector<rc_fifo_in<int>*>         in_ports;
+    std::vector<rc_fifo_out<int>*>        out_ports;
+    std::vector<lanePortMap*>             portmaps;
+    std::vector<rc_fifo_in_filter<int>*>  in_filters;
+    std::vector<rc_fifo_out_filter<int>*> out_filters;
+};
+
+#endif // MODULES_H_
+
+//
+// $Id$
+//
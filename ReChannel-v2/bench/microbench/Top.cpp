@@ -0,0 +1,227 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    Top.cpp
+ * @brief   Top module of the microbenchmarks.
+ */
+
+#include <algorithm>
+#include <sstream>
+
+#include "Top.h"
+
+Top::Top(sc_module_name name_, int count_)
+    : sc_module(name_),
+      fifo("fifo", 64), ctrl("ctrl"),
+      plain_worker("plain_worker"), filtered_worker("filtered_worker"),
+      count(count_)
+{
+    in_portal.bind_static(sig_in);
+    out_portal.bind_static(sig_out);
+    fin_portal.bind_static(fifo);
+    fout_portal.bind_static(fifo);
+
+    in_portal.bind_dynamic(plain_worker.in);
+    out_portal.bind_dynamic(plain_worker.out);
+    fin_portal.bind_dynamic(plain_worker.fin);
+    fout_portal.bind_dynamic(plain_worker.fout);
+
+    in_portal.bind_dynamic(filtered_worker.in);
+    out_portal.bind_dynamic(filtered_worker.out);
+    fin_portal.bind_dynamic(filtered_worker.fin);
+    fout_portal.bind_dynamic(filtered_worker.fout);
+
+    filtered_worker.enable_filters();
+
+    ctrl.add(plain_worker + filtered_worker);
+
+    // event forwarding: one portal and listener per fan-out branch
+    for (int i=0; i < BENCH_FANOUT; ++i) {
+        rc_portal<sc_in<int> >* portal = new rc_portal<sc_in<int> >(
+            sc_gen_unique_name("fanout_portal"));
+        Listener_rc* listener =
+            new Listener_rc(sc_gen_unique_name("listener"));
+        portal->bind_static(sig_fanout);
+        portal->bind_dynamic(listener->in);
+        ctrl.add(*listener);
+        fanout_portals.push_back(portal);
+        listeners.push_back(listener);
+    }
+
+    // reconfiguration control of sets
+    for (int i=0; i < BENCH_MAX_SET_SIZE; ++i) {
+        Empty_rc* module = new Empty_rc(sc_gen_unique_name("empty"));
+        ctrl.add(*module);
+        empty_modules.push_back(module);
+    }
+
+    SC_THREAD(bench_proc);
+}
+
+Top::~Top()
+{
+    for (unsigned int i=0; i < fanout_portals.size(); ++i) {
+        delete listeners[i];
+        delete fanout_portals[i];
+    }
+    for (unsigned int i=0; i < empty_modules.size(); ++i) {
+        delete empty_modules[i];
+    }
+}
+
+void Top::bench_proc()
+{
+    std::cout << "ReChannel microbenchmarks (" << count
+              << " operations each)" << std::endl;
+
+    ctrl.activate(plain_worker);
+    run_worker("portal write (sc_out)", plain_worker, TASK_SIGNAL_WRITE);
+    run_worker("portal read (sc_in)", plain_worker, TASK_SIGNAL_READ);
+    run_worker("rc_fifo via fifo portals", plain_worker, TASK_FIFO, 32);
+    run_worker("rc_get_current_process_handle()",
+        plain_worker, TASK_PROCESS_HANDLE);
+    ctrl.unload(plain_worker);
+
+    ctrl.activate(filtered_worker);
+    run_worker("portal write (sc_out) (filtered)",
+        filtered_worker, TASK_SIGNAL_WRITE);
+    run_worker("portal read (sc_in) (filtered)",
+        filtered_worker, TASK_SIGNAL_READ);
+    run_worker("rc_fifo via fifo portals (filtered)",
+        filtered_worker, TASK_FIFO, 32);
+    ctrl.unload(filtered_worker);
+
+    bench_event_fanout();
+    bench_activate_deactivate();
+    bench_load_unload();
+    bench_control_sets();
+
+    sc_stop();
+}
+
+void Top::run_worker(
+    const std::string& name, Worker_rc& worker,
+    bench_task task, int batch)
+{
+    worker.task = task;
+    worker.count = count;
+    worker.batch = batch;
+
+    bench_timer timer;
+    timer.start();
+    // a delta notification, since the worker may not yet wait for it
+    worker.start_event.notify(SC_ZERO_TIME);
+    wait(worker.done_event);
+    timer.stop();
+
+    bench_report(name, count, timer);
+}
+
+void Top::bench_event_fanout()
+{
+    rc_reconfigurable_set listener_set;
+    for (unsigned int i=0; i < listeners.size(); ++i) {
+        listener_set.insert(*listeners[i]);
+        listeners[i]->wakeups = 0;
+    }
+    ctrl.activate(listener_set);
+
+    const int rounds = count / BENCH_FANOUT;
+    bench_timer timer;
+    timer.start();
+    for (int i=1; i <= rounds; ++i) {
+        sig_fanout.write(i);
+        wait(SC_ZERO_TIME);
+    }
+    wait(SC_ZERO_TIME);
+    timer.stop();
+
+    unsigned long wakeups = 0;
+    for (unsigned int i=0; i < listeners.size(); ++i) {
+        wakeups += listeners[i]->wakeups;
+    }
+    std::ostringstream name;
+    name << "event forwarding (fan-out " << BENCH_FANOUT << ")";
+    bench_report(name.str(), wakeups, timer);
+
+    ctrl.unload(listener_set);
+}
+
+void Top::bench_activate_deactivate()
+{
+    const int rounds = count / 100;
+    ctrl.load(plain_worker);
+
+    bench_timer timer;
+    timer.start();
+    for (int i=0; i < rounds; ++i) {
+        ctrl.activate(plain_worker);
+        ctrl.deactivate(plain_worker);
+    }
+    timer.stop();
+    bench_report("activate/deactivate round trip", rounds, timer);
+
+    ctrl.unload(plain_worker);
+}
+
+void Top::bench_load_unload()
+{
+    const int rounds = count / 100;
+
+    bench_timer timer;
+    timer.start();
+    for (int i=0; i < rounds; ++i) {
+        ctrl.load(plain_worker);
+        ctrl.unload(plain_worker);
+    }
+    timer.stop();
+    bench_report("load/unload round trip", rounds, timer);
+}
+
+void Top::bench_control_sets()
+{
+    for (int size=1; size <= BENCH_MAX_SET_SIZE; size *= 2) {
+        rc_reconfigurable_set reconf_set;
+        for (int i=0; i < size; ++i) {
+            reconf_set.insert(*empty_modules[i]);
+        }
+        // at least one round, each round handles size modules
+        const int rounds = std::max(1, count / 100 / size);
+
+        bench_timer timer;
+        timer.start();
+        for (int i=0; i < rounds; ++i) {
+            ctrl.activate(reconf_set);
+            ctrl.unload(reconf_set);
+        }
+        timer.stop();
+
+        std::ostringstream name;
+        name << "rc_control set activate/unload (" << size << ")";
+        bench_report(name.str(), rounds * size, timer);
+    }
+}
+
+//
+// $Id$
+//
@@ -0,0 +1,103 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    Top.h
+ * @brief   Top module of the microbenchmarks.
+ */
+
+#ifndef TOP_H_
+#define TOP_H_
+
+#include <vector>
+
+#include <systemc.h>
+#include <ReChannel.h>
+
+#include "bench.h"
+#include "modules.h"
+
+// number of listeners in the event forwarding benchmark
+#define BENCH_FANOUT 16
+
+// size of the largest reconfigurable set controlled in parallel
+#define BENCH_MAX_SET_SIZE 256
+
+SC_MODULE(Top)
+{
+    // static channels
+    sc_signal<int> sig_in;
+    sc_signal<int> sig_out;
+    sc_signal<int> sig_fanout;
+    rc_fifo<int>   fifo;
+
+    // portals
+    rc_portal<sc_in<int> >       in_portal;
+    rc_portal<sc_out<int> >      out_portal;
+    rc_portal<sc_fifo_in<int> >  fin_portal;
+    rc_portal<sc_fifo_out<int> > fout_portal;
+
+    // reconfiguration control
+    rc_control ctrl;
+
+    // reconfigurable modules
+    Worker_rc plain_worker;
+    Worker_rc filtered_worker;
+
+    SC_HAS_PROCESS(Top);
+
+    // count is the number of operations per benchmark
+    Top(sc_module_name name_, int count_);
+
+    ~Top();
+
+private:
+
+    void bench_proc();
+
+    // runs a task on the given (active) worker
+    void run_worker(
+        const std::string& name, Worker_rc& worker,
+        bench_task task, int batch=1);
+
+    void bench_event_fanout();
+
+    void bench_activate_deactivate();
+
+    void bench_load_unload();
+
+    void bench_control_sets();
+
+private:
+
+    int count;
+
+    std::vector<rc_portal<sc_in<int> >*> fanout_portals;
+    std::vector<Listener_rc*>            listeners;
+    std::vector<Empty_rc*>               empty_modules;
+};
+
+#endif // TOP_H_
+
+//
+// $Id$
+//
@@ -0,0 +1,97 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    bench.h
+ * @brief   Timing and allocation counting of the microbenchmarks.
+ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <sys/time.h>
+
+#include <iostream>
+#include <iomanip>
+
+// number of calls to operator new (counted in main.cpp)
+extern unsigned long bench_alloc_count;
+
+/* Measures the wall-clock time and the allocations between start() and
+ * stop().
+ */
+class bench_timer
+{
+public:
+    bench_timer()
+        : p_seconds(0.0), p_alloc_begin(0), p_allocs(0)
+    { }
+
+    void start()
+    {
+        p_alloc_begin = bench_alloc_count;
+        gettimeofday(&p_begin, NULL);
+    }
+
+    void stop()
+    {
+        struct timeval end;
+        gettimeofday(&end, NULL);
+        p_allocs = bench_alloc_count - p_alloc_begin;
+        p_seconds = (end.tv_sec - p_begin.tv_sec)
+            + (end.tv_usec - p_begin.tv_usec) / 1000000.0;
+    }
+
+    double get_seconds() const
+        { return p_seconds; }
+
+    unsigned long get_allocs() const
+        { return p_allocs; }
+
+private:
+    struct timeval p_begin;
+    double         p_seconds;
+    unsigned long  p_alloc_begin;
+    unsigned long  p_allocs;
+};
+
+// prints ops/sec and allocations per op of a finished measurement
+inline void bench_report(
+    const std::string& name, unsigned long ops, const bench_timer& timer)
+{
+    const double seconds = timer.get_seconds();
+    const double ops_per_sec = (seconds > 0.0 ? ops / seconds : 0.0);
+    const double allocs_per_op =
+        (ops > 0 ? (double)timer.get_allocs() / ops : 0.0);
+    std::cout << std::left << std::setw(44) << name << std::right
+              << std::fixed
+              << std::setw(14) << std::setprecision(0) << ops_per_sec
+              << " ops/s"
+              << std::setw(10) << std::setprecision(3) << allocs_per_op
+              << " allocs/op" << std::endl;
+}
+
+#endif // BENCH_H_
+
+//
+// $Id$
+//
@@ -0,0 +1,96 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    main.cpp
+ * @brief   Main C++ file of benchmark project 'microbench'.
+ *
+ * The microbenchmarks measure the wall-clock cost of ReChannel's hot
+ * paths. Each benchmark prints the operations per second and the number
+ * of heap allocations per operation.
+ *
+ * Usage: microbench.x [operations]
+ */
+
+#include <cstdlib>
+#include <new>
+
+#include <systemc.h>
+
+#include "Top.h"
+
+#if __cplusplus >= 201103L
+#define BENCH_THROW_BAD_ALLOC
+#define BENCH_NOTHROW noexcept
+#else
+#define BENCH_THROW_BAD_ALLOC throw(std::bad_alloc)
+#define BENCH_NOTHROW throw()
+#endif
+
+unsigned long bench_alloc_count = 0;
+
+/* counting replacements of the global allocation functions */
+
+void* operator new(std::size_t size) BENCH_THROW_BAD_ALLOC
+{
+    ++bench_alloc_count;
+    void* p = std::malloc(size > 0 ? size : 1);
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new[](std::size_t size) BENCH_THROW_BAD_ALLOC
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) BENCH_NOTHROW
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) BENCH_NOTHROW
+{
+    std::free(p);
+}
+
+int sc_main(int argc, char* argv[])
+{
+    int count = 100000;
+    if (argc > 1) {
+        count = std::atoi(argv[1]);
+    }
+    if (count < 100) {
+        count = 100;
+    }
+
+    Top* top = new Top("top", count);
+    sc_start();
+    delete top;
+    return 0;
+}
+
+//
+// $Id$
+//
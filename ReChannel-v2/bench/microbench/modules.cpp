@@ -0,0 +1,72 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    modules.cpp
+ * @brief   Reconfigurable modules of the microbenchmarks.
+ */
+
+#include "modules.h"
+
+void Worker_rc::proc()
+{
+    while(true) {
+        wait(start_event);
+        switch(task) {
+        case TASK_SIGNAL_WRITE:
+            for (int i=0; i < count; ++i) {
+                out.write(i);
+            }
+            break;
+        case TASK_SIGNAL_READ:
+            result = 0;
+            for (int i=0; i < count; ++i) {
+                result += in.read();
+            }
+            break;
+        case TASK_FIFO:
+            for (int i=0; i < count; i += 2 * batch) {
+                for (int j=0; j < batch; ++j) {
+                    fout.nb_write(j);
+                }
+                wait(SC_ZERO_TIME);
+                for (int j=0; j < batch; ++j) {
+                    fin.nb_read(result);
+                }
+                wait(SC_ZERO_TIME);
+            }
+            break;
+        case TASK_PROCESS_HANDLE:
+            result = 0;
+            for (int i=0; i < count; ++i) {
+                rc_process_handle hproc = rc_get_current_process_handle();
+                result += (hproc.valid() ? 1 : 0);
+            }
+            break;
+        }
+        done_event.notify(SC_ZERO_TIME);
+    }
+}
+
+//
+// $Id$
+//
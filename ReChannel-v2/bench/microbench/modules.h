@@ -0,0 +1,134 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    modules.h
+ * @brief   Reconfigurable modules of the microbenchmarks.
+ */
+
+#ifndef MODULES_H_
+#define MODULES_H_
+
+#include <systemc.h>
+#include <ReChannel.h>
+
+// the operation a Worker_rc performs on its next start
+enum bench_task
+{
+    TASK_SIGNAL_WRITE,
+    TASK_SIGNAL_READ,
+    TASK_FIFO,
+    TASK_PROCESS_HANDLE
+};
+
+/* Class 'pass_filter' forwards all interface calls unchanged. It is used
+ * to measure the cost of the filter chain itself.
+ */
+template<class IF>
+class pass_filter
+    : public rc_abstract_prim_filter<IF>
+{
+public:
+    pass_filter()
+    { }
+};
+
+/* Module 'Worker_rc' performs a number of interface calls through its
+ * ports each time start_event is notified. done_event is notified
+ * after the last call.
+ */
+RC_RECONFIGURABLE_MODULE(Worker_rc)
+{
+    rc_in<int>       in;
+    rc_out<int>      out;
+    rc_fifo_in<int>  fin;
+    rc_fifo_out<int> fout;
+
+    sc_event start_event;
+    sc_event done_event;
+
+    bench_task task;
+    int        count; // number of calls
+    int        batch; // number of fifo calls per delta cycle
+    int        result;
+
+    RC_RECONFIGURABLE_CTOR(Worker_rc),
+        task(TASK_SIGNAL_WRITE), count(0), batch(1), result(0)
+    {
+        RC_THREAD(proc);
+    }
+
+    // inserts a filter into the path of each port
+    void enable_filters()
+    {
+        rc_add_filter(in, in_filter);
+        rc_add_filter(out, out_filter);
+        rc_add_filter(fin, fin_filter);
+        rc_add_filter(fout, fout_filter);
+    }
+
+private:
+    void proc();
+
+private:
+    pass_filter<sc_signal_in_if<int> >    in_filter;
+    pass_filter<sc_signal_inout_if<int> > out_filter;
+    rc_fifo_in_filter<int>  fin_filter;
+    rc_fifo_out_filter<int> fout_filter;
+};
+
+/* Module 'Listener_rc' counts the forwarded value changed events of its
+ * input.
+ */
+RC_RECONFIGURABLE_MODULE(Listener_rc)
+{
+    rc_in<int> in;
+
+    unsigned long wakeups;
+
+    RC_RECONFIGURABLE_CTOR(Listener_rc),
+        wakeups(0)
+    {
+        RC_METHOD(proc);
+        sensitive << in;
+        dont_initialize();
+    }
+
+private:
+    void proc()
+        { ++wakeups; }
+};
+
+/* Module 'Empty_rc' has no ports and no processes. It is used to measure
+ * the cost of the reconfiguration control itself.
+ */
+RC_RECONFIGURABLE_MODULE(Empty_rc)
+{
+    RC_RECONFIGURABLE_CTOR(Empty_rc)
+    { }
+};
+
+#endif // MODULES_H_
+
+//
+// $Id$
+//
@@ -117,15 +117,20 @@ namespace ReChannel {
  * connected, of course).
  *
  * The dynamic side is represented by a group of modules, the so-called 
- * <em>reconfigurable modules</em>. Among them only one single module can be
- * <em>loaded</em> at a time, all others have to be <em>unloaded</em>. In
+ * <em>reconfigurable modules</em>. Each of them is either <em>loaded</em> or
+ * <em>unloaded</em>. In
  * simulation semantics a loaded module is regarded as being existent, whereas
  * an unloaded module is regarded as being nonexistent. A loaded module can be
  * in one of two states: <em>active</em> or <em>inactive</em>. Only if a module
  * is currently active, it is allowed to communicate with channels and modules
  * on the static side. The inactive module is regarded as existent but not yet
  * ready for regular operation and is hence still blocked from the outside
- * world. <em>Reconfiguration</em> is defined as the operation of replacing two
+ * world. Among the modules of a group only one single module can be active
+ * at a time, but several modules may be loaded (inactive) at the same time.
+ * This allows a module to be loaded in the background while another one is
+ * still active (<em>shadow loading</em>), so that a subsequent exchange only
+ * costs the deactivation and activation delays.
+ * <em>Reconfiguration</em> is defined as the operation of replacing two
  * reconfigurable modules. In simulation semantics this means unloading the
  * currently loaded module and subsequently loading one of the unloaded modules
  * of the group. The dynamic side is said to be <em>undefined</em> if no
@@ -1105,10 +1110,14 @@ namespace ReChannel {
 
 #include "ReChannel/core/rc_common_header.h"
 #include "ReChannel/core/rc_process.h"
+#include "ReChannel/core/rc_local_time.h"
+#include "ReChannel/core/rc_trace.h"
+#include "ReChannel/core/rc_phase_profile.h"
 #include "ReChannel/core/rc_interface_filter.h"
 #include "ReChannel/core/rc_switch.h"
 #include "ReChannel/core/rc_reconfigurable.h"
 #include "ReChannel/core/rc_reconfigurable_module.h"
+#include "ReChannel/core/rc_reconfigurable_placeholder.h"
 #include "ReChannel/core/rc_transaction_counter.h"
 #include "ReChannel/core/rc_control.h"
 #include "ReChannel/core/rc_portmap.h"
@@ -1118,6 +1127,8 @@ namespace ReChannel {
 #include "ReChannel/util/rc_report.h"
 #include "ReChannel/util/rc_driver_object.h"
 #include "ReChannel/util/rc_port_traits.h"
+#include "ReChannel/util/rc_stats.h"
+#include "ReChannel/util/rc_profiler.h"
 
 #include "ReChannel/communication/accessors/rc_accessor.h"
 #include "ReChannel/communication/accessors/rc_signal_accessors.h"
@@ -1125,6 +1136,7 @@ namespace ReChannel {
 #include "ReChannel/communication/accessors/rc_mutex_accessor.h"
 #include "ReChannel/communication/accessors/rc_semaphore_accessor.h"
 #include "ReChannel/communication/accessors/rc_event_queue_accessor.h"
+#include "ReChannel/communication/accessors/rc_memory_accessor.h"
 
 #include "ReChannel/communication/portals/rc_portal.h"
 #include "ReChannel/communication/portals/rc_signal_portals.h"
@@ -1134,6 +1146,7 @@ namespace ReChannel {
 #include "ReChannel/communication/portals/rc_mutex_portal.h"
 #include "ReChannel/communication/portals/rc_semaphore_portal.h"
 #include "ReChannel/communication/portals/rc_event_queue_portal.h"
+#include "ReChannel/communication/portals/rc_memory_portal.h"
 
 #include "ReChannel/communication/exportals/rc_exportal.h"
 #include "ReChannel/communication/exportals/rc_signal_exportals.h"
@@ -1141,6 +1154,7 @@ namespace ReChannel {
 #include "ReChannel/communication/exportals/rc_mutex_exportal.h"
 #include "ReChannel/communication/exportals/rc_semaphore_exportal.h"
 #include "ReChannel/communication/exportals/rc_event_queue_exportal.h"
+#include "ReChannel/communication/exportals/rc_memory_exportal.h"
 
 #include "ReChannel/communication/filters/rc_abstract_filter.h"
 #include "ReChannel/communication/filters/rc_abstract_prim_filter.h"
@@ -39,6 +39,10 @@
 namespace ReChannel {
 
 rc_abstract_accessor_b::rc_abstract_accessor_b()
+#ifdef RC_ENABLE_PROFILER
+    : p_profiler_samples(RC_PROFILER_GET_SAMPLES(
+        static_cast<const rc_interface_filter*>(this), FORWARD))
+#endif // RC_ENABLE_PROFILER
 { }
 
 void rc_abstract_accessor_b::register_port(
@@ -40,6 +40,8 @@
 #include "ReChannel/core/rc_common_header.h"
 #include "ReChannel/core/rc_process.h"
 #include "ReChannel/util/rc_hash_map.h"
+#include "ReChannel/util/rc_stats.h"
+#include "ReChannel/util/rc_profiler.h"
 #include "ReChannel/communication/rc_report_ids.h"
 #include "ReChannel/communication/rc_fallback_interface.h"
 #include "ReChannel/communication/rc_interface_wrapper.h"
@@ -188,6 +190,10 @@ private:
     process_index_map p_process_index_map;
     process_index_map p_nb_process_index_map;
 
+#ifdef RC_ENABLE_PROFILER
+    rc_profiler::samples* p_profiler_samples;
+#endif // RC_ENABLE_PROFILER
+
 private:
     // disabled
     rc_abstract_accessor_b(const rc_abstract_accessor_b& accessor);
@@ -196,7 +202,16 @@ private:
 
 /* interal helper macros for repetitive code generation */
 
+#define _RC_STATS_ACCESSOR_INC(counter_) \
+    RC_STATS_INC( \
+        static_cast<const rc_interface_wrapper_base::accessor_base*>( \
+            this), counter_)
+
+#define _RC_PROFILER_ACCESSOR_SCOPE() \
+    RC_PROFILER_SCOPE(this->p_profiler_samples)
+
 #define _RECHANNEL_ACCESSOR_NB_FW_(if_method_args, wrapper_call) \
+    _RC_PROFILER_ACCESSOR_SCOPE(); \
     try { \
         if (p_target_if != NULL) { \
             return ((p_target_if->*method)if_method_args); \
@@ -209,11 +224,14 @@ private:
             ::ReChannel::rc_throw(e); \
         } else { \
             delete e; /* consume cancel exception */ \
+            _RC_STATS_ACCESSOR_INC(CANCEL_CONSUMED); \
         } \
     } \
+    _RC_STATS_ACCESSOR_INC(FALLBACK_CALL); \
     return ((rc_get_fallback_if().*method)if_method_args);
 
 #define _RECHANNEL_ACCESSOR_FW_(if_method_args, wrapper_call) \
+    _RC_PROFILER_ACCESSOR_SCOPE(); \
     rc_process_handle hproc = rc_get_current_process_handle(); \
     while(true) { \
         try { \
@@ -229,6 +247,7 @@ private:
                 ::ReChannel::rc_throw(e); \
             } else { \
                 delete e; /* consume cancel exception */ \
+                _RC_STATS_ACCESSOR_INC(CANCEL_CONSUMED); \
             } \
         } \
         this->_rc_wait_activation(); \
@@ -1096,6 +1115,8 @@ private:
 #undef _RECHANNEL_ACCESSOR_FW
 #undef _RECHANNEL_ACCESSOR_NB_FW_DRV
 #undef _RECHANNEL_ACCESSOR_FW_DRV
+#undef _RC_STATS_ACCESSOR_INC
+#undef _RC_PROFILER_ACCESSOR_SCOPE
 
 /* template code */
 
@@ -0,0 +1,126 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_memory_accessor.h
+ * @brief   Defines the accessor for the rc_memory channel.
+ *
+ * This file contains the accessor for the rc_memory_if interface
+ * as well as the implementation of the respective rc_fallback_interface.
+ */
+
+#ifndef RC_MEMORY_ACCESSOR_H_
+#define RC_MEMORY_ACCESSOR_H_
+
+#include "ReChannel/communication/accessors/rc_accessor.h"
+#include "ReChannel/core/rc_memory_if.h"
+
+namespace ReChannel {
+
+/**
+ * @brief Fallback interface for a memory.
+ */
+template<class T>
+class rc_fallback_interface<rc_memory_if<T> >
+: virtual public rc_memory_if<T>
+{
+public:
+    typedef typename rc_memory_if<T>::address_type address_type;
+public:
+    rc_fallback_interface()
+    : p_value(rc_undefined_value<T>())
+    { }
+    virtual address_type size() const
+        { return 0; }
+    virtual T read(address_type addr) const
+        { return p_value; }
+    virtual void write(address_type addr, const T& value)
+        { }
+    virtual void burst_read(
+        address_type addr, T* data, unsigned int count) const
+        { std::fill(data, data + count, p_value); }
+    virtual void burst_write(
+        address_type addr, const T* data, unsigned int count)
+        { }
+    virtual const T* get_read_ptr(
+        address_type addr, unsigned int& count) const
+        { count = 0; return NULL; }
+    virtual T* get_write_ptr(address_type addr, unsigned int& count)
+        { count = 0; return NULL; }
+private:
+    const T p_value;
+};
+
+/**
+ * @brief Accessor for a memory.
+ *
+ * \remark Direct pointers obtained through the accessor bypass the
+ *         switch. They must not be used after the switch has been closed.
+ */
+template<class T>
+RC_ACCESSOR_TEMPLATE(rc_memory_if<T>)
+{
+    RC_ACCESSOR_TEMPLATE_CTOR(rc_memory_if<T>) { }
+
+    typedef typename rc_memory_if<T>::address_type address_type;
+
+    virtual address_type size() const
+    {
+        return this->rc_nb_forward(&if_type::size);
+    }
+    virtual T read(address_type addr) const
+    {
+        return this->rc_nb_forward(&if_type::read, addr);
+    }
+    virtual void write(address_type addr, const T& value)
+    {
+        this->rc_nb_forward(&if_type::write, addr, rc_cref(value));
+    }
+    virtual void burst_read(
+        address_type addr, T* data, unsigned int count) const
+    {
+        this->rc_nb_forward(&if_type::burst_read, addr, data, count);
+    }
+    virtual void burst_write(
+        address_type addr, const T* data, unsigned int count)
+    {
+        this->rc_nb_forward(&if_type::burst_write, addr, data, count);
+    }
+    virtual const T* get_read_ptr(
+        address_type addr, unsigned int& count) const
+    {
+        return this->rc_nb_forward(
+            &if_type::get_read_ptr, addr, rc_ref(count));
+    }
+    virtual T* get_write_ptr(address_type addr, unsigned int& count)
+    {
+        return this->rc_nb_forward(
+            &if_type::get_write_ptr, addr, rc_ref(count));
+    }
+};
+
+} // namespace ReChannel
+
+#endif // RC_MEMORY_ACCESSOR_H_
+//
+// $Id$
+//
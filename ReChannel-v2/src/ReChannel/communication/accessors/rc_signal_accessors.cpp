@@ -41,14 +41,25 @@ namespace ReChannel {
 void rc_accessor<sc_signal_in_if<bool> >::register_process_control(
     rc_process_control& pctrl, bool active_level) const
 {
-    _rc_get_reset_signal().register_process_control(
+    _rc_get_reset_monitor().register_process_control(
         pctrl, active_level);
 }
 
 void rc_accessor<sc_signal_in_if<bool> >::unregister_process_control(
     rc_process_control& pctrl) const
 {
-    _rc_get_reset_signal().unregister_process_control(pctrl);
+    if (p_reset_monitor != NULL) {
+        p_reset_monitor->unregister_process_control(pctrl);
+    }
+}
+
+internals::reset_monitor& rc_accessor<sc_signal_in_if<bool> >::_rc_get_reset_monitor() const
+{
+    if (p_reset_monitor == NULL) {
+        // the monitor observes the accessor itself
+        p_reset_monitor = new internals::reset_monitor(*this);
+    }
+    return *p_reset_monitor;
 }
 
 rc_accessor<sc_signal_in_if<bool> >::reset_signal_type&
@@ -87,14 +98,25 @@ void rc_accessor<sc_signal_in_if<bool> >::_rc_reset_updater_proc()
 void rc_accessor<sc_signal_inout_if<bool> >::register_process_control(
     rc_process_control& pctrl, bool active_level) const
 {
-    _rc_get_reset_signal().register_process_control(
+    _rc_get_reset_monitor().register_process_control(
         pctrl, active_level);
 }
 
 void rc_accessor<sc_signal_inout_if<bool> >::unregister_process_control(
     rc_process_control& pctrl) const
 {
-    _rc_get_reset_signal().unregister_process_control(pctrl);
+    if (p_reset_monitor != NULL) {
+        p_reset_monitor->unregister_process_control(pctrl);
+    }
+}
+
+internals::reset_monitor& rc_accessor<sc_signal_inout_if<bool> >::_rc_get_reset_monitor() const
+{
+    if (p_reset_monitor == NULL) {
+        // the monitor observes the accessor itself
+        p_reset_monitor = new internals::reset_monitor(*this);
+    }
+    return *p_reset_monitor;
 }
 
 rc_accessor<sc_signal_inout_if<bool> >::reset_signal_type&
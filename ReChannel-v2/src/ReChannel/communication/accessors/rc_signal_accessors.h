@@ -223,7 +223,7 @@ public:
     typedef sc_signal_in_if<bool> if_type;
 
     rc_accessor()
-        : p_reset_signal(NULL)
+        : p_reset_signal(NULL), p_reset_monitor(NULL)
     { }
 
 #if !defined(RC_USE_NON_OSCI_KERNEL)
@@ -246,7 +246,7 @@ protected:
         rc_process_control& pctrl) const;
 
     virtual bool get_current_level() const
-    { return (p_reset_signal != NULL ? p_reset_signal->read() : false); }
+    { return (p_reset_monitor != NULL ? this->read() : false); }
 
     virtual const sc_signal<bool>* get_underlying_reset_signal() const
         { return &_rc_get_reset_signal(); }
@@ -257,8 +257,12 @@ private:
 
     void _rc_reset_updater_proc();
 
+    internals::reset_monitor& _rc_get_reset_monitor() const;
+
 private:
-    mutable reset_signal_type* p_reset_signal;
+    // (is only required for the reset of SystemC's CTHREADs)
+    mutable reset_signal_type*        p_reset_signal;
+    mutable internals::reset_monitor* p_reset_monitor;
 };
 
 /**
@@ -367,7 +371,7 @@ public:
     typedef sc_signal_inout_if<bool> if_type;
 
     rc_accessor()
-        : p_reset_signal(NULL)
+        : p_reset_signal(NULL), p_reset_monitor(NULL)
     { }
 
 #if !defined(RC_USE_NON_OSCI_KERNEL)
@@ -390,7 +394,7 @@ protected:
         rc_process_control& pctrl) const;
 
     virtual bool get_current_level() const
-    { return (p_reset_signal != NULL ? p_reset_signal->read() : false); }
+    { return (p_reset_monitor != NULL ? this->read() : false); }
 
     virtual const sc_signal<bool>* get_underlying_reset_signal() const
         { return &_rc_get_reset_signal(); }
@@ -401,8 +405,12 @@ private:
 
     void _rc_reset_updater_proc();
 
+    internals::reset_monitor& _rc_get_reset_monitor() const;
+
 private:
-    mutable reset_signal_type* p_reset_signal;
+    // (is only required for the reset of SystemC's CTHREADs)
+    mutable reset_signal_type*        p_reset_signal;
+    mutable internals::reset_monitor* p_reset_monitor;
 };
 
 /**
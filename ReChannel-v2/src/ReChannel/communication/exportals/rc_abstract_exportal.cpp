@@ -46,7 +46,8 @@ rc_exportal_base::rc_exportal_base(
       p_transaction_count(transaction_count),
       s_wrapper_pool(s_wrapper_pool_),
       p_first_dyn_filter(NULL), p_dyn_module(NULL),
-      p_exclusive_wrapper(NULL)
+      p_exclusive_wrapper(NULL),
+      p_abort_epoch(0), p_total_transaction_count(0)
 { }
 
 sc_interface* rc_exportal_base::get_dynamic_interface() const
@@ -146,6 +147,9 @@ void rc_exportal_base::bind_exclusively(rc_interface_wrapper_base& wrapper)
     this->register_reconfigurable(*module, dynamic_if_);
     module->rc_register_switch(*this, *channel_);
     p_exclusive_wrapper = &wrapper;
+    RC_STATS_SET_OWNER(
+        static_cast<const rc_interface_wrapper_base*>(&wrapper),
+        static_cast<const rc_switch*>(this));
 }
 
 void rc_exportal_base::open()
@@ -323,6 +327,7 @@ void rc_exportal_base::open(
     p_dyn_module = &module;
     // set portal to opened state
     p_state = rc_switch::OPEN;
+    RC_TRACE_INSTANT(this, this->name(), SWITCH_OPEN);
     // call user-defined event handler (if simulation is running)
     if (sc_is_running()) {
         this->rc_on_open();
@@ -352,6 +357,7 @@ void rc_exportal_base::close()
         p_reserved_wrapper_handle = p_dyn_wrapper_handle;
         // set state to CLOSED
         p_state = rc_switch::CLOSED;
+        RC_TRACE_INSTANT(this, this->name(), SWITCH_CLOSE);
         // call user-defined event handler (if simulation is running)
         if (sc_is_running()) {
             this->rc_on_close();
@@ -382,6 +388,7 @@ void rc_exportal_base::set_undefined()
         p_reserved_wrapper_handle = p_dyn_wrapper_handle;
         // set state to UNDEF
         p_state = rc_switch::UNDEF;
+        RC_TRACE_INSTANT(this, this->name(), SWITCH_UNDEF);
         // call user-defined event handler (if simulation is running)
         if (sc_is_running()) {
             // exportals do not have a special callback for undefined state
@@ -390,6 +397,14 @@ void rc_exportal_base::set_undefined()
     }
 }
 
+void rc_exportal_base::abort_transactions()
+{
+    // the pending transactions are no longer counted by this switch,
+    //   their owners are told by the tag (see end_access_callback())
+    ++p_abort_epoch;
+    p_transaction_count = 0;
+}
+
 void rc_exportal_base::register_reconfigurable(
         rc_reconfigurable& module, sc_interface& dyn_if)
 {
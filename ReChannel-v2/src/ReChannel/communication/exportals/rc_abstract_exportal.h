@@ -63,6 +63,7 @@ protected:
     typedef internals::exportal::wrapper_factory wrapper_factory;
 
     typedef rc_interface_wrapper_base::accessor_base accessor_base_type;
+    typedef rc_interface_wrapper_base::transaction_tag transaction_tag;
     typedef rc_switch::filter_chain                  filter_chain;
 
 protected:
@@ -80,6 +81,10 @@ public:
     virtual rc_reconfigurable* get_current_reconfigurable() const
         { return p_dyn_module; }
 
+    /** @brief returns the total number of begun transactions */
+    virtual unsigned long get_total_transaction_count() const
+        { return p_total_transaction_count; }
+
     /** @brief returns the currently active dynamic interface */
     virtual sc_interface* get_dynamic_interface() const;
 
@@ -117,6 +122,9 @@ protected:
     /** @brief deactivates the current dynamic module and set to undefined state */
     virtual void set_undefined();
 
+    /** @brief discards the pending transactions of the current dynamic module */
+    virtual void abort_transactions();
+
     /** @brief refreshes the event notifications of this exportal */
     virtual void refresh_notify()
         { this->rc_on_refresh_notify(); }
@@ -129,10 +137,11 @@ protected:
     virtual void unregister_reconfigurable(rc_reconfigurable& module);
 
     /** @brief callback for interface accesses (begin access) */
-    inline rc_process_behavior_change begin_access_callback();
+    inline rc_process_behavior_change begin_access_callback(
+        transaction_tag& tag);
 
     /** @brief callback for interface accesses (end access) */
-    inline void end_access_callback();
+    inline void end_access_callback(const transaction_tag& tag);
 
     /** @brief notifies the specified dynamic event */
     void notify_event(const std::string& event_name);
@@ -191,6 +200,12 @@ private:
 
     /** @brief wrapper of an exclusive bound interface */
     rc_interface_wrapper_base* p_exclusive_wrapper;
+
+    /** @brief the abort epoch (advanced by abort_transactions()) */
+    unsigned int        p_abort_epoch;
+
+    /** @brief total number of begun transactions */
+    unsigned long       p_total_transaction_count;
 };
 
 /**
@@ -424,12 +439,13 @@ protected:
         { return p_exportal->create_accessor(); }
 
     /** @brief callback for interface accesses (begin access) */
-    virtual rc_process_behavior_change begin_access_callback()
-        { return p_exportal->begin_access_callback(); }
+    virtual rc_process_behavior_change begin_access_callback(
+        transaction_tag& tag)
+        { return p_exportal->begin_access_callback(tag); }
 
     /** @brief callback for interface accesses (end access) */
-    virtual void end_access_callback()
-        { p_exportal->end_access_callback(); }
+    virtual void end_access_callback(const transaction_tag& tag)
+        { p_exportal->end_access_callback(tag); }
 
 private:
     /** @brief a reference to the exportal owning this object */
@@ -439,11 +455,15 @@ private:
 /* inline code */
 
 inline
-rc_process_behavior_change rc_exportal_base::begin_access_callback()
+rc_process_behavior_change rc_exportal_base::begin_access_callback(
+    transaction_tag& tag)
 {
     ++p_transaction_count;
+    ++p_total_transaction_count;
+    tag.owner = p_dyn_module;
+    tag.switch_epoch = p_abort_epoch;
     if (p_dyn_module != NULL) {
-        p_dyn_module->rc_begin_transaction();
+        tag.owner_epoch = p_dyn_module->rc_begin_tagged_transaction();
         rc_process_handle hproc = rc_get_current_process_handle();
         return hproc.behavior_change(false);
     } else {
@@ -452,13 +472,14 @@ rc_process_behavior_change rc_exportal_base::begin_access_callback()
 }
 
 inline
-void rc_exportal_base::end_access_callback()
+void rc_exportal_base::end_access_callback(const transaction_tag& tag)
 {
-    if (p_transaction_count > 0) {
+    // a transaction discarded by abort_transactions() is no longer counted
+    if (tag.switch_epoch == p_abort_epoch && p_transaction_count > 0) {
         --p_transaction_count;
     }
-    if (p_dyn_module != NULL) {
-        p_dyn_module->rc_end_transaction();
+    if (tag.owner != NULL) {
+        tag.owner->rc_end_tagged_transaction(tag.owner_epoch);
     }
 }
 
@@ -610,6 +631,16 @@ rc_abstract_exportal<IF>::get_static_accessor() const
 {
     if (p_static_accessor == NULL) {
         p_static_accessor = this->create_accessor();
+        RC_STATS_REGISTER_SWITCH(
+            static_cast<const rc_switch*>(this), this->name());
+        RC_STATS_SET_OWNER(
+            static_cast<const rc_interface_wrapper_base::accessor_base*>(
+                p_static_accessor),
+            static_cast<const rc_switch*>(this));
+        RC_PROFILER_SET_SWITCH(
+            static_cast<const rc_interface_filter*>(
+                p_static_accessor),
+            this->get_switch_name());
     }
     return *p_static_accessor;
 }
@@ -647,6 +678,10 @@ void rc_abstract_exportal<IF>::_rc_set_interface_wrapper_owner(
     if (wrapper_ != NULL) {
         wrapper_->set_owner(*this);
     }
+    // (pooled wrappers are accounted to their current owner)
+    RC_STATS_SET_OWNER(
+        static_cast<const rc_interface_wrapper_base*>(wrapper),
+        static_cast<const rc_switch*>(this));
 }
 
 } // namespace ReChannel
@@ -0,0 +1,52 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_memory_exportal.h
+ * @brief   Exportal for rc_memory channels.
+ *
+ * This file contains the exportal switch for the rc_memory_if interface.
+ */
+
+#ifndef RC_MEMORY_EXPORTAL_H_
+#define RC_MEMORY_EXPORTAL_H_
+
+#include "ReChannel/communication/exportals/rc_exportal.h"
+#include "ReChannel/communication/accessors/rc_memory_accessor.h"
+
+namespace ReChannel {
+
+/**
+ * @brief Exportal switch for a memory.
+ */
+template<class T>
+RC_EXPORTAL_TEMPLATE(rc_memory_if<T>)
+{
+    RC_EXPORTAL_TEMPLATE_CTOR(rc_memory_if<T>) { }
+};
+
+} // namespace ReChannel
+
+#endif // RC_MEMORY_EXPORTAL_H_
+//
+// $Id$
+//
@@ -44,7 +44,8 @@ rc_portal_base::rc_portal_base(
     : sc_module(module_name), p_state(state),
       p_transaction_count(transaction_count),
       p_interface_wrapper(NULL), p_dyn_accessor(NULL),
-      p_last_dyn_filter(NULL), p_dyn_module(NULL)
+      p_last_dyn_filter(NULL), p_dyn_module(NULL),
+      p_abort_epoch(0), p_total_transaction_count(0)
 { }
 
 void rc_portal_base::_rc_init(rc_interface_wrapper_base& interface_wrapper)
@@ -55,6 +56,12 @@ void rc_portal_base::_rc_init(rc_interface_wrapper_base& interface_wrapper)
     // initialize (if necessary)
     if (p_interface_wrapper == NULL) {
         p_interface_wrapper = &interface_wrapper;
+        RC_STATS_REGISTER_SWITCH(
+            static_cast<const rc_switch*>(this), this->name());
+        RC_STATS_SET_OWNER(
+            static_cast<const rc_interface_wrapper_base*>(
+                &interface_wrapper),
+            static_cast<const rc_switch*>(this));
     }
 }
 
@@ -240,6 +247,7 @@ void rc_portal_base::open(
     p_dyn_module = &module;
     // set portal to opened state
     p_state = rc_switch::OPEN;
+    RC_TRACE_INSTANT(this, this->name(), SWITCH_OPEN);
     // call user-defined event handler (if simulation is running)
     if (sc_is_running()) {
         this->rc_on_open();
@@ -268,6 +276,7 @@ void rc_portal_base::close()
         this->clear_event_forwarder_targets();
         // set state to CLOSED
         p_state = rc_switch::CLOSED;
+        RC_TRACE_INSTANT(this, this->name(), SWITCH_CLOSE);
         // call user-defined event handler (if simulation is running)
         if (sc_is_running()) {
             this->rc_on_close();
@@ -298,6 +307,7 @@ void rc_portal_base::set_undefined()
         this->clear_event_forwarder_targets();
         // set state to UNDEF
         p_state = rc_switch::UNDEF;
+        RC_TRACE_INSTANT(this, this->name(), SWITCH_UNDEF);
         // call user-defined event handler (if simulation is running)
         if (sc_is_running()) {
             this->rc_on_undef();
@@ -305,6 +315,14 @@ void rc_portal_base::set_undefined()
     }
 }
 
+void rc_portal_base::abort_transactions()
+{
+    // the pending transactions are no longer counted by this switch,
+    //   their owners are told by the tag (see end_access_callback())
+    ++p_abort_epoch;
+    p_transaction_count = 0;
+}
+
 void rc_portal_base::register_reconfigurable(
         rc_reconfigurable& module, sc_interface& dyn_if)
 {
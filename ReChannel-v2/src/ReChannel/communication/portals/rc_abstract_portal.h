@@ -59,6 +59,7 @@ private:
 
 protected:
     typedef rc_interface_wrapper_base::accessor_base accessor_base_type;
+    typedef rc_interface_wrapper_base::transaction_tag transaction_tag;
     typedef rc_switch::filter_chain                  filter_chain;
 
 protected:
@@ -75,6 +76,10 @@ public:
     virtual rc_reconfigurable* get_current_reconfigurable() const
         { return p_dyn_module; }
 
+    /** @brief returns the total number of begun transactions */
+    virtual unsigned long get_total_transaction_count() const
+        { return p_total_transaction_count; }
+
     /** @brief returns the currently active dynamic interface */
     virtual sc_interface* get_dynamic_interface() const
         { return p_dyn_accessor; }
@@ -109,6 +114,9 @@ protected:
     /** @brief deactivates the current dynamic module and set to undefined state */
     virtual void set_undefined();
 
+    /** @brief discards the pending transactions of the current dynamic module */
+    virtual void abort_transactions();
+
     /** @brief refreshes the event notifications of this portal */
     virtual void refresh_notify()
         { this->rc_on_refresh_notify(); }
@@ -121,10 +129,11 @@ protected:
     virtual void unregister_reconfigurable(rc_reconfigurable& module);
 
     /** @brief callback for interface accesses (begin access) */
-    inline rc_process_behavior_change begin_access_callback();
+    inline rc_process_behavior_change begin_access_callback(
+        transaction_tag& tag);
 
     /** @brief callback for interface accesses (end access) */
-    inline void end_access_callback();
+    inline void end_access_callback(const transaction_tag& tag);
 
     virtual ~rc_portal_base() {}
 
@@ -164,6 +173,12 @@ private:
 
     /** @brief currently active dynamic module */
     rc_reconfigurable* p_dyn_module;
+
+    /** @brief the abort epoch (advanced by abort_transactions()) */
+    unsigned int p_abort_epoch;
+
+    /** @brief total number of begun transactions */
+    unsigned long p_total_transaction_count;
 };
 
 /**
@@ -321,12 +336,13 @@ protected:
         { return p_portal.create_accessor(); }
 
     /** @brief callback for interface accesses (begin access) */
-    virtual rc_process_behavior_change begin_access_callback()
-        { return p_portal.begin_access_callback(); }
+    virtual rc_process_behavior_change begin_access_callback(
+        transaction_tag& tag)
+        { return p_portal.begin_access_callback(tag); }
 
     /** @brief callback for interface accesses (end access) */
-    virtual void end_access_callback()
-        { p_portal.end_access_callback(); }
+    virtual void end_access_callback(const transaction_tag& tag)
+        { p_portal.end_access_callback(tag); }
 
 private:
     /** @brief a reference to the portal owning this object */
@@ -367,7 +383,7 @@ public:
 
     /** @brief bind the portal to a given static channel */
     void bind_static(if_type& channel_)
-        { static_port.bind(channel_); }
+        { this_type::_rc_bind_interface(static_port, channel_); }
 
     /** @brief create a new accessor and bind it to the given dynamic port */
     void bind_dynamic(port_type& port_);
@@ -392,6 +408,12 @@ protected:
 
     virtual void bind_dynamic_object(const rc_object_handle& obj_to_bind);
 
+private:
+
+    /** @brief binds a port to an interface (also if PORT is a socket) */
+    static inline void _rc_bind_interface(port_type& port_, if_type& if_)
+        { static_cast<sc_port_b<if_type>&>(port_).bind(if_); }
+
 public:
     /** @brief the port for the static interface */
     port_type static_port;
@@ -404,23 +426,28 @@ private:
 
 /* inline code */
 
-inline rc_process_behavior_change rc_portal_base::begin_access_callback()
+inline rc_process_behavior_change rc_portal_base::begin_access_callback(
+    transaction_tag& tag)
 {
     ++p_transaction_count;
+    ++p_total_transaction_count;
+    tag.owner = p_dyn_module;
+    tag.switch_epoch = p_abort_epoch;
     if (p_dyn_module != NULL) {
-        p_dyn_module->rc_begin_transaction();
+        tag.owner_epoch = p_dyn_module->rc_begin_tagged_transaction();
     }
     rc_process_handle hproc = rc_get_current_process_handle();
     return hproc.behavior_change(false);
 }
 
-inline void rc_portal_base::end_access_callback()
+inline void rc_portal_base::end_access_callback(const transaction_tag& tag)
 {
-    if (p_transaction_count > 0) {
+    // a transaction discarded by abort_transactions() is no longer counted
+    if (tag.switch_epoch == p_abort_epoch && p_transaction_count > 0) {
         --p_transaction_count;
     }
-    if (p_dyn_module != NULL) {
-        p_dyn_module->rc_end_transaction();
+    if (tag.owner != NULL) {
+        tag.owner->rc_end_tagged_transaction(tag.owner_epoch);
     }
 }
 
@@ -559,7 +586,14 @@ void rc_abstract_portal<PORT>::bind_dynamic(port_type& port_)
                 "method create_accessor() did not create an accessor"
                 " (in portal '" << this->name() << "')");
         }
-        port_.bind(*accessor_);
+        RC_STATS_SET_OWNER(
+            static_cast<const rc_interface_wrapper_base::accessor_base*>(
+                accessor_),
+            static_cast<const rc_switch*>(this));
+        RC_PROFILER_SET_SWITCH(
+            static_cast<const rc_interface_filter*>(accessor_),
+            this->get_switch_name());
+        this_type::_rc_bind_interface(port_, *accessor_);
     }
     register_port(port_);
 }
@@ -569,7 +603,7 @@ void rc_abstract_portal<PORT>::unused()
 {
     if_type* undef_if = rc_fallback_interface_factory<if_type>::create();
     if (undef_if != NULL) {
-        static_port.bind(*undef_if);
+        this_type::_rc_bind_interface(static_port, *undef_if);
         p_is_unused = true;
     } else {
         RC_REPORT_ERROR(RC_ID_NOT_IMPLEMENTED_,
@@ -592,7 +626,7 @@ void rc_abstract_portal<PORT>::bind_static_object(
     } else if (obj_to_bind.is_channel()) {
         if_type* if_to_bind = dynamic_cast<if_type*>(*obj_to_bind);
         if (if_to_bind != NULL) {
-            static_port.bind(*if_to_bind);
+            this_type::_rc_bind_interface(static_port, *if_to_bind);
             return;
         }
     }
@@ -0,0 +1,74 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_memory_portal.h
+ * @brief   Portal for rc_memory channels.
+ *
+ * This file contains the rc_memory_portal class.
+ */
+
+#ifndef RC_MEMORY_PORTAL_H_
+#define RC_MEMORY_PORTAL_H_
+
+#include "ReChannel/communication/portals/rc_portal.h"
+#include "ReChannel/communication/accessors/rc_memory_accessor.h"
+
+namespace ReChannel {
+
+/**
+ * @brief Portal for a memory port.
+ */
+template<class T>
+RC_PORTAL_TEMPLATE(sc_port<rc_memory_if<T> >)
+{
+    RC_PORTAL_TEMPLATE_CTOR(sc_port<rc_memory_if<T> >) { }
+};
+
+/* named portal specialization */
+
+/**
+ * @brief Portal for a memory port (named).
+ */
+template<class T>
+class rc_memory_portal
+    : public rc_portal<sc_port<rc_memory_if<T> > >
+{
+    typedef rc_portal<sc_port<rc_memory_if<T> > > base_type;
+public:
+    typedef typename base_type::port_type     port_type;
+    typedef typename base_type::if_type       if_type;
+    typedef typename base_type::accessor_type accessor_type;
+
+    explicit rc_memory_portal(
+        const sc_module_name& name_ =
+            sc_gen_unique_name("rc_memory_portal"))
+        : base_type(name_)
+    { }
+};
+
+} // namespace ReChannel
+
+#endif // RC_MEMORY_PORTAL_H_
+//
+// $Id$
+//
@@ -176,6 +176,12 @@ void rc_abstract_interface_wrapper_b::add_event_forwarder(
             << this->get_interface_wrapper_name() << "')");
     }
     item_ref = &forwarder;
+    RC_STATS_SET_OWNER(
+        static_cast<const rc_event_forwarder_base*>(&forwarder),
+        static_cast<const rc_interface_wrapper_base*>(this));
+    RC_PROFILER_SET_SWITCH(
+        static_cast<const rc_event_forwarder_base*>(&forwarder),
+        this->get_interface_wrapper_name());
     this->_rc_spawn_event_forwarder_process(forwarder, e);
 }
 
@@ -116,10 +116,11 @@ protected:
         sc_port_base& port_, const char* if_typename)
     { this->get_wrapped_interface().register_port(port_, if_typename); }
 
-    virtual rc_process_behavior_change begin_access_callback()
+    virtual rc_process_behavior_change begin_access_callback(
+        transaction_tag& tag)
         { return rc_process_behavior_change(); }
 
-    virtual void end_access_callback() { };
+    virtual void end_access_callback(const transaction_tag& tag) { };
 
     inline int get_driver_count() const
         { return p_drv_obj_vector.size(); }
@@ -455,7 +456,11 @@ void* rc_abstract_interface_wrapper<IF>::_rc_create_driver_object(
     void* if_) const
 {
     IF* if__ = reinterpret_cast<IF*>(if_);
-    return new drv_obj_type(*if__);
+    drv_obj_type* drv_obj = new drv_obj_type(*if__);
+    RC_STATS_SET_OWNER(
+        static_cast<const rc_driver_object_base*>(drv_obj),
+        static_cast<const rc_interface_wrapper_base*>(this));
+    return drv_obj;
 }
 
 template<class IF>
@@ -463,7 +468,11 @@ void* rc_abstract_interface_wrapper<IF>::_rc_create_nb_driver_object(
     void* if_) const
 {
     IF* if__ = reinterpret_cast<IF*>(if_);
-    return new nb_drv_obj_type(*if__);
+    nb_drv_obj_type* nb_drv_obj = new nb_drv_obj_type(*if__);
+    RC_STATS_SET_OWNER(
+        static_cast<const rc_driver_object_base*>(nb_drv_obj),
+        static_cast<const rc_interface_wrapper_base*>(this));
+    return nb_drv_obj;
 }
 
 template<class IF>
@@ -40,21 +40,50 @@
 namespace ReChannel {
 
 rc_abstract_switch_b::rc_abstract_switch_b()
-    : m_state(UNDEF), m_transaction_count(0), p_lock_owner(NULL)
+    : m_state(UNDEF), m_transaction_count(0), p_exclusive_lock_owner(NULL)
 { }
 
 rc_abstract_switch_b::~rc_abstract_switch_b()
 { }
 
+bool rc_abstract_switch_b::is_lock_owner(
+    const rc_reconfigurable& reconf) const
+{
+    return (p_lock_owner_set.find(const_cast<rc_reconfigurable*>(&reconf))
+        != p_lock_owner_set.end());
+}
+
 bool rc_abstract_switch_b::set_locked(
     rc_reconfigurable& lock_owner, bool lock)
 {
-    if (p_lock_owner == NULL || p_lock_owner == &lock_owner) {
-        p_lock_owner = (lock ? &lock_owner : NULL);
-        return true;
+    if (lock) {
+        p_lock_owner_set.insert(&lock_owner);
     } else {
+        p_lock_owner_set.erase(&lock_owner);
+        if (p_exclusive_lock_owner == &lock_owner) {
+            p_exclusive_lock_owner = NULL;
+        }
+    }
+    return true;
+}
+
+bool rc_abstract_switch_b::set_exclusively_locked(
+    rc_reconfigurable& lock_owner, bool lock)
+{
+    if (p_exclusive_lock_owner != NULL
+    && p_exclusive_lock_owner != &lock_owner)
+    {
         return false;
     }
+    if (lock) {
+        if (!is_lock_owner(lock_owner)) {
+            return false;
+        }
+        p_exclusive_lock_owner = &lock_owner;
+    } else {
+        p_exclusive_lock_owner = NULL;
+    }
+    return true;
 }
 
 void rc_abstract_switch_b::register_reconfigurable(
@@ -58,6 +58,7 @@ class rc_abstract_switch_b
 
 private:
     typedef std::set<void*>                     set;
+    typedef std::set<rc_reconfigurable*>        module_set;
     typedef std::map<rc_reconfigurable*, void*> module_void_map;
 public:
     typedef rc_switch::state_type state_type;
@@ -79,7 +80,10 @@ public:
     }
 
     virtual bool is_locked() const
-        { return (p_lock_owner != NULL); }
+        { return !p_lock_owner_set.empty(); }
+
+    virtual bool is_exclusively_locked() const
+        { return (p_exclusive_lock_owner != NULL); }
 
     virtual std::string get_switch_kind() const
         { return "switch"; }
@@ -96,11 +100,17 @@ protected:
 
     virtual void unregister_reconfigurable(rc_reconfigurable& module);
 
-    virtual bool is_lock_owner(const rc_reconfigurable& reconf) const
-        { return (p_lock_owner == &reconf); }
+    virtual bool is_lock_owner(const rc_reconfigurable& reconf) const;
 
     virtual bool set_locked(rc_reconfigurable& lock_owner, bool lock);
 
+    virtual bool is_exclusive_lock_owner(
+        const rc_reconfigurable& reconf) const
+        { return (p_exclusive_lock_owner == &reconf); }
+
+    virtual bool set_exclusively_locked(
+        rc_reconfigurable& lock_owner, bool lock);
+
 private:
 
     inline void* find_registered_if(rc_reconfigurable* module) const;
@@ -123,7 +133,8 @@ private:
 
 /* for internal use only! */
 
-    rc_reconfigurable* p_lock_owner;
+    module_set         p_lock_owner_set;
+    rc_reconfigurable* p_exclusive_lock_owner;
     set                p_interface_set;
     module_void_map    p_mod_if_map;
 
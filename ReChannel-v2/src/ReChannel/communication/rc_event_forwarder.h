@@ -40,6 +40,8 @@
 #include "ReChannel/core/rc_common_header.h"
 #include "ReChannel/core/rc_process.h"
 #include "ReChannel/core/rc_event_filter.h"
+#include "ReChannel/util/rc_stats.h"
+#include "ReChannel/util/rc_profiler.h"
 
 namespace ReChannel {
 
@@ -191,6 +193,11 @@ protected:
      * @brief further target events
      */
     target_vector        m_targets;
+
+#ifdef RC_ENABLE_PROFILER
+private:
+    rc_profiler::samples* p_profiler_samples;
+#endif // RC_ENABLE_PROFILER
 };
 
 /**
@@ -262,6 +269,10 @@ template<class IF>
 rc_event_forwarder<IF>::rc_event_forwarder(
     event_getter_type event_getter_method)
     : m_get_event(event_getter_method)
+#ifdef RC_ENABLE_PROFILER
+      , p_profiler_samples(RC_PROFILER_GET_SAMPLES(
+          static_cast<const rc_event_forwarder_base*>(this), EVENT))
+#endif // RC_ENABLE_PROFILER
 {
     assert( !event_getter_method.empty() );
 }
@@ -372,11 +383,15 @@ void rc_event_forwarder<IF>::clear_targets()
 template<class IF>
 void rc_event_forwarder<IF>::trigger_event()
 {
+    RC_PROFILER_SCOPE(p_profiler_samples);
     if (m_target1.e != NULL)
     {
         if (m_target1.filter != NULL
         && !m_target1.filter->rc_on_event(*(m_target1.e)))
         {
+            RC_STATS_INC(
+                static_cast<const rc_event_forwarder_base*>(this),
+                EVENT_SUPPRESSED);
             return;
         }
         rc_notify(*(m_target1.e));
@@ -386,6 +401,9 @@ void rc_event_forwarder<IF>::trigger_event()
             if (m_target2.filter != NULL
             && !m_target2.filter->rc_on_event(*(m_target2.e)))
             {
+                RC_STATS_INC(
+                    static_cast<const rc_event_forwarder_base*>(this),
+                    EVENT_SUPPRESSED);
                 return;
             }
             rc_notify(*(m_target2.e));
@@ -403,6 +421,10 @@ void rc_event_forwarder<IF>::trigger_event()
                     if (target_.filter != NULL
                     && !target_.filter->rc_on_event(*(target_.e))) 
                     {
+                        RC_STATS_INC(
+                            static_cast<const rc_event_forwarder_base*>(
+                                this),
+                            EVENT_SUPPRESSED);
                         return;
                     }
                     rc_notify(*(target_.e));
@@ -415,6 +437,7 @@ void rc_event_forwarder<IF>::trigger_event()
 template<class IF>
 void rc_event_forwarder<IF>::rc_trigger_event(const sc_event& start_event)
 {
+    RC_PROFILER_SCOPE(p_profiler_samples);
     bool is_started = false;
     if (m_target1.e != NULL)
     {
@@ -434,6 +457,9 @@ void rc_event_forwarder<IF>::rc_trigger_event(const sc_event& start_event)
                 && !is_start_event
                 && m_target2.filter->rc_on_event(*(m_target2.e)))
                 {
+                    RC_STATS_INC(
+                        static_cast<const rc_event_forwarder_base*>(this),
+                        EVENT_SUPPRESSED);
                     return;
                 }
                 rc_notify(*(m_target2.e));
@@ -457,6 +483,10 @@ void rc_event_forwarder<IF>::rc_trigger_event(const sc_event& start_event)
                         && !is_start_event
                         && target_.filter->rc_on_event(*(target_.e)))
                         {
+                            RC_STATS_INC(
+                                static_cast<const rc_event_forwarder_base*>(
+                                    this),
+                                EVENT_SUPPRESSED);
                             return;
                         }
                         rc_notify(*(target_.e));
@@ -47,6 +47,8 @@
 
 namespace ReChannel {
 
+class rc_reconfigurable;
+
 /**
  * @brief Base ABI of rc_interface_wrapper<IF>.
  */
@@ -55,6 +57,27 @@ class rc_interface_wrapper_base
 public:
     class accessor_base;
 
+    /**
+     * @brief Identifies the owner of a begun transaction.
+     *
+     * The tag is stamped by begin_access_callback() and handed back to
+     * end_access_callback(), so that a transaction is always ended
+     * against the module (and the epoch) it has been begun in.
+     */
+    struct transaction_tag
+    {
+        transaction_tag()
+            : owner(NULL), owner_epoch(0), switch_epoch(0)
+        { }
+
+        /** @brief the module the transaction belongs to (or NULL) */
+        rc_reconfigurable* owner;
+        /** @brief the transaction epoch of the owner */
+        unsigned int       owner_epoch;
+        /** @brief the abort epoch of the switch */
+        unsigned int       switch_epoch;
+    };
+
 protected:
     class access_base;
 
@@ -73,9 +96,10 @@ public:
 protected:
     virtual bool set_wrapped_interface(sc_interface& if_) = 0;
 
-    virtual rc_process_behavior_change begin_access_callback() = 0;
+    virtual rc_process_behavior_change begin_access_callback(
+        transaction_tag& tag) = 0;
 
-    virtual void end_access_callback() = 0;
+    virtual void end_access_callback(const transaction_tag& tag) = 0;
 };
 
 /**
@@ -87,12 +111,14 @@ public:
     access_base() { }
 
 protected:
-    inline rc_process_behavior_change
-        begin_access(rc_interface_wrapper_base& wrapper) const
-        { return wrapper.begin_access_callback(); }
-
-    inline void end_access(rc_interface_wrapper_base& wrapper) const
-        { wrapper.end_access_callback(); }
+    inline rc_process_behavior_change begin_access(
+        rc_interface_wrapper_base& wrapper, transaction_tag& tag) const
+        { return wrapper.begin_access_callback(tag); }
+
+    inline void end_access(
+        rc_interface_wrapper_base& wrapper,
+        const transaction_tag& tag) const
+        { wrapper.end_access_callback(tag); }
 };
 
 /**
@@ -249,7 +275,7 @@ class rc_interface_wrapper<IF>::interface_access
 public:
     inline explicit interface_access(rc_interface_wrapper<IF>& wrapper)
         : p_wrapper(wrapper),
-          p_process_behavior_change(begin_access(wrapper))
+          p_process_behavior_change(begin_access(wrapper, p_tag))
     { }
 
     inline IF* operator->() const
@@ -264,10 +290,11 @@ public:
     }
 
     inline ~interface_access()
-        { end_access(p_wrapper); }
+        { end_access(p_wrapper, p_tag); }
 
 private:
     rc_interface_wrapper<IF>&        p_wrapper;
+    transaction_tag                  p_tag;
     const rc_process_behavior_change p_process_behavior_change;
 };
 
@@ -304,7 +331,7 @@ public:
     inline driver_access(
         rc_interface_wrapper<IF>& wrapper, int driver_index)
         : p_wrapper(wrapper), p_driver_index(driver_index),
-          p_process_behavior_change(begin_access(wrapper))
+          p_process_behavior_change(begin_access(wrapper, p_tag))
     { }
 
     inline
@@ -312,11 +339,12 @@ public:
         { return p_wrapper.driver_access_callback(p_driver_index); }
 
     inline ~driver_access()
-        { end_access(p_wrapper); }
+        { end_access(p_wrapper, p_tag); }
 
 private:
     rc_interface_wrapper<IF>&        p_wrapper;
     const int                        p_driver_index;
+    transaction_tag                  p_tag;
     const rc_process_behavior_change p_process_behavior_change;
 };
 
@@ -40,6 +40,7 @@
 #include "ReChannel/components/rc_module.h"
 #include "ReChannel/components/rc_ports.h"
 #include "ReChannel/components/rc_var.h"
+#include "ReChannel/components/rc_resettable_block.h"
 #include "ReChannel/components/rc_join.h"
 
 #include "ReChannel/components/rc_prim_channel.h"
@@ -50,6 +51,7 @@
 #include "ReChannel/components/rc_fifo.h"
 #include "ReChannel/components/rc_mutex.h"
 #include "ReChannel/components/rc_semaphore.h"
+#include "ReChannel/components/rc_memory.h"
 
 #include "ReChannel/components/rc_sc_event.h"
 #include "ReChannel/components/rc_sc_signal.h"
@@ -107,6 +107,9 @@ protected:
         }
     }
 
+    virtual bool rc_is_dirty_tracking() const
+        { return true; }
+
     RC_ON_RESET()
     {
         // clear the FIFO
@@ -124,6 +127,30 @@ protected:
         }
     }
 
+    RC_ON_SAVE_CONTEXT()
+    {
+        // store fifo's current content
+        m_context_values.clear();
+        m_context_values.insert(
+            m_context_values.end(), m_deque.begin(), m_deque.end());
+    }
+
+    RC_ON_RESTORE_CONTEXT()
+    {
+        // clear the FIFO
+        m_deque.clear();
+        m_num_read = 0;
+        m_num_written = 0;
+        m_data_read_event.cancel();
+        m_data_written_event.cancel();
+
+        // restore the stored content
+        m_deque.insert(
+            m_deque.end(), m_context_values.begin(),
+            m_context_values.end());
+        m_context_values.clear();
+    }
+
 protected:
 
     std::deque<T>       m_deque;
@@ -138,6 +165,7 @@ protected:
     const sc_port_base* m_writer_port;
 
     std::vector<T>      m_reset_values;
+    std::vector<T>      m_context_values;
 
 private:
     // disabled
@@ -0,0 +1,402 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_memory.h
+ * @brief   Class rc_memory.
+ */
+
+#ifndef RC_MEMORY_H_
+#define RC_MEMORY_H_
+
+#include "ReChannel/components/rc_prim_channel.h"
+#include "ReChannel/core/rc_memory_if.h"
+
+#include <algorithm>
+
+namespace ReChannel {
+
+/**
+ * @brief Resettable memory with copy-on-write pages.
+ *
+ * rc_memory models a (large) RAM inside a reconfigurable context. The
+ * reset image of the memory is kept read-only, the live contents are
+ * stored in pages that are copied from the reset image on the first
+ * write access. A reset simply drops the modified pages, hence its cost
+ * only depends on the number of pages written since the last reset.
+ *
+ * The reset image is either owned by the memory or provided by the user
+ * (e.g. a memory-mapped file). In the latter case the image is not
+ * copied and has to exist as long as the memory. Words written during
+ * elaboration become part of the reset image.
+ *
+ * \see rc_memory_if, rc_memory_portal
+ */
+template<class T>
+class rc_memory
+    : public rc_memory_if<T>,
+      public rc_prim_channel
+{
+private:
+    typedef rc_memory<T>                         this_type;
+    typedef std::vector<T*>                      page_vector;
+    typedef std::vector<unsigned int>            index_vector;
+
+public:
+    typedef typename rc_memory_if<T>::address_type address_type;
+
+    /** @brief the default page size (in bytes) */
+    enum { default_page_bytes = 4096 };
+
+public:
+
+    explicit rc_memory(address_type size_, unsigned int page_size_=0);
+
+    rc_memory(
+        const char* name_, address_type size_, unsigned int page_size_=0);
+
+    /**
+     * @brief Constructs a memory based on an external reset image.
+     * \attention image_ has to contain size_ words and has to exist as
+     *            long as this memory.
+     */
+    rc_memory(
+        const char* name_, const T* image_, address_type size_,
+        unsigned int page_size_=0);
+
+    virtual const char* kind() const
+        { return "rc_memory"; }
+
+    /* interface methods */
+
+    virtual address_type size() const
+        { return p_size; }
+
+    inline virtual T read(address_type addr) const;
+
+    inline virtual void write(address_type addr, const T& value);
+
+    virtual void burst_read(
+        address_type addr, T* data, unsigned int count) const;
+
+    virtual void burst_write(
+        address_type addr, const T* data, unsigned int count);
+
+    virtual const T* get_read_ptr(
+        address_type addr, unsigned int& count) const;
+
+    virtual T* get_write_ptr(address_type addr, unsigned int& count);
+
+    /* other methods */
+
+    /** @brief returns the page size (in words) */
+    inline unsigned int get_page_size() const
+        { return p_page_size; }
+
+    /** @brief returns the number of pages modified since the last reset */
+    inline unsigned int get_dirty_page_count() const
+        { return p_dirty_pages.size(); }
+
+    /** @brief returns the read-only reset image */
+    inline const T* get_reset_image() const
+        { return p_image; }
+
+    virtual ~rc_memory();
+
+protected:
+
+    virtual bool rc_is_dirty_tracking() const
+        { return true; }
+
+    RC_ON_INIT_RESETTABLE();
+
+    RC_ON_RESET();
+
+private:
+    void _rc_init(unsigned int page_size_);
+
+    T* _rc_fetch_page(unsigned int page);
+
+    void _rc_check_range(address_type addr, address_type count) const;
+
+private:
+    address_type   p_size;
+    unsigned int   p_page_size;
+    const T*       p_image;
+    std::vector<T> p_image_data;
+    page_vector    p_page_table;
+    index_vector   p_dirty_pages;
+    page_vector    p_free_pages;
+
+private:
+    // disabled
+    rc_memory(const this_type& other);
+    this_type& operator=(const this_type& other);
+};
+
+/* inline code */
+
+template<class T>
+inline T rc_memory<T>::read(address_type addr) const
+{
+    this->_rc_check_range(addr, 1);
+    const T* const page = p_page_table[(unsigned int)(addr / p_page_size)];
+    if (page != NULL) {
+        return page[addr % p_page_size];
+    } else {
+        return p_image[addr];
+    }
+}
+
+template<class T>
+inline void rc_memory<T>::write(address_type addr, const T& value)
+{
+    if (this->rc_is_active() || !sc_is_running()) {
+        this->_rc_check_range(addr, 1);
+        T* page = p_page_table[(unsigned int)(addr / p_page_size)];
+        if (page == NULL) {
+            page = this->_rc_fetch_page((unsigned int)(addr / p_page_size));
+        }
+        page[addr % p_page_size] = value;
+    }
+}
+
+/* template code */
+
+template<class T>
+rc_memory<T>::rc_memory(address_type size_, unsigned int page_size_)
+    : rc_prim_channel(sc_gen_unique_name("memory")),
+      p_size(size_), p_image(NULL), p_image_data(size_)
+{
+    this->_rc_init(page_size_);
+}
+
+template<class T>
+rc_memory<T>::rc_memory(
+    const char* name_, address_type size_, unsigned int page_size_)
+    : rc_prim_channel(name_),
+      p_size(size_), p_image(NULL), p_image_data(size_)
+{
+    this->_rc_init(page_size_);
+}
+
+template<class T>
+rc_memory<T>::rc_memory(
+    const char* name_, const T* image_, address_type size_,
+    unsigned int page_size_)
+    : rc_prim_channel(name_),
+      p_size(size_), p_image(image_)
+{
+    if (image_ == NULL) {
+        RC_REPORT_ERROR(RC_ID_NULL_POINTER_,
+            "reset image is NULL (in memory '" << this->name() << "')");
+    }
+    this->_rc_init(page_size_);
+}
+
+template<class T>
+rc_memory<T>::~rc_memory()
+{
+    for (typename page_vector::iterator it = p_page_table.begin();
+        it != p_page_table.end();
+        ++it)
+    {
+        delete[] *it;
+    }
+    for (typename page_vector::iterator it = p_free_pages.begin();
+        it != p_free_pages.end();
+        ++it)
+    {
+        delete[] *it;
+    }
+}
+
+template<class T>
+void rc_memory<T>::burst_read(
+    address_type addr, T* data, unsigned int count) const
+{
+    this->_rc_check_range(addr, count);
+    while (count > 0) {
+        unsigned int n;
+        const T* const src = this->get_read_ptr(addr, n);
+        n = std::min(n, count);
+        std::copy(src, src + n, data);
+        data += n;
+        addr += n;
+        count -= n;
+    }
+}
+
+template<class T>
+void rc_memory<T>::burst_write(
+    address_type addr, const T* data, unsigned int count)
+{
+    if (this->rc_is_active() || !sc_is_running()) {
+        this->_rc_check_range(addr, count);
+        while (count > 0) {
+            unsigned int n;
+            T* const dst = this->get_write_ptr(addr, n);
+            n = std::min(n, count);
+            std::copy(data, data + n, dst);
+            data += n;
+            addr += n;
+            count -= n;
+        }
+    }
+}
+
+template<class T>
+const T* rc_memory<T>::get_read_ptr(
+    address_type addr, unsigned int& count) const
+{
+    this->_rc_check_range(addr, 1);
+    const unsigned int page_index = (unsigned int)(addr / p_page_size);
+    const unsigned int offset = (unsigned int)(addr % p_page_size);
+    count = (unsigned int)
+        std::min<address_type>(p_page_size - offset, p_size - addr);
+    const T* const page = p_page_table[page_index];
+    if (page != NULL) {
+        return page + offset;
+    } else {
+        return p_image + addr;
+    }
+}
+
+template<class T>
+T* rc_memory<T>::get_write_ptr(address_type addr, unsigned int& count)
+{
+    if (!this->rc_is_active() && sc_is_running()) {
+        count = 0;
+        return NULL;
+    }
+    this->_rc_check_range(addr, 1);
+    const unsigned int page_index = (unsigned int)(addr / p_page_size);
+    const unsigned int offset = (unsigned int)(addr % p_page_size);
+    count = (unsigned int)
+        std::min<address_type>(p_page_size - offset, p_size - addr);
+    T* page = p_page_table[page_index];
+    if (page == NULL) {
+        page = this->_rc_fetch_page(page_index);
+    }
+    return page + offset;
+}
+
+template<class T>
+void rc_memory<T>::rc_on_init_resettable()
+{
+    if (p_dirty_pages.empty()) {
+        return;
+    }
+    // words written during elaboration become part of the reset image
+    if (p_image_data.empty()) {
+        p_image_data.assign(p_image, p_image + p_size);
+    }
+    for (index_vector::const_iterator it = p_dirty_pages.begin();
+        it != p_dirty_pages.end();
+        ++it)
+    {
+        const address_type start = (address_type)(*it) * p_page_size;
+        const unsigned int n = (unsigned int)
+            std::min<address_type>(p_page_size, p_size - start);
+        T* const page = p_page_table[*it];
+        std::copy(page, page + n, p_image_data.begin() + start);
+    }
+    p_image = &p_image_data[0];
+    this->rc_on_reset();
+}
+
+template<class T>
+void rc_memory<T>::rc_on_reset()
+{
+    // drop all modified pages
+    for (index_vector::const_iterator it = p_dirty_pages.begin();
+        it != p_dirty_pages.end();
+        ++it)
+    {
+        p_free_pages.push_back(p_page_table[*it]);
+        p_page_table[*it] = NULL;
+    }
+    p_dirty_pages.clear();
+}
+
+template<class T>
+void rc_memory<T>::_rc_init(unsigned int page_size_)
+{
+    if (p_size == 0) {
+        RC_REPORT_ERROR(RC_ID_INVALID_USAGE_,
+            "memory size must be greater than zero"
+            " (in memory '" << this->name() << "')");
+    }
+    if (page_size_ == 0) {
+        page_size_ = default_page_bytes / sizeof(T);
+        if (page_size_ == 0) {
+            page_size_ = 1;
+        }
+    }
+    p_page_size = page_size_;
+    if (p_image == NULL) {
+        p_image = &p_image_data[0];
+    }
+    p_page_table.resize(
+        (std::size_t)((p_size + p_page_size - 1) / p_page_size), NULL);
+}
+
+template<class T>
+T* rc_memory<T>::_rc_fetch_page(unsigned int page_index)
+{
+    T* page;
+    if (!p_free_pages.empty()) {
+        page = p_free_pages.back();
+        p_free_pages.pop_back();
+    } else {
+        page = new T[p_page_size];
+    }
+    // copy on write
+    const address_type start = (address_type)page_index * p_page_size;
+    const unsigned int n = (unsigned int)
+        std::min<address_type>(p_page_size, p_size - start);
+    std::copy(p_image + start, p_image + start + n, page);
+
+    p_page_table[page_index] = page;
+    p_dirty_pages.push_back(page_index);
+    this->rc_set_dirty();
+    return page;
+}
+
+template<class T>
+void rc_memory<T>::_rc_check_range(
+    address_type addr, address_type count) const
+{
+    if (addr >= p_size || count > p_size - addr) {
+        RC_REPORT_ERROR(RC_ID_OUT_OF_BOUNDS_,
+            "out of bounds (in memory '" << this->name()
+            << "', at address: " << addr << ")");
+    }
+}
+
+} // namespace ReChannel
+
+#endif //RC_MEMORY_H_
+
+//
+// $Id$
+//
@@ -55,6 +55,13 @@ void rc_mutex::rc_on_reset()
     rc_notify(m_free);
 }
 
+void rc_mutex::rc_on_restore_context()
+{
+    // the lock owner has been cancelled on deactivation,
+    // hence the lock state can not be preserved
+    rc_mutex::rc_on_reset();
+}
+
 int rc_mutex::lock()
 {
     while(this->is_locked()) {
@@ -67,6 +67,8 @@ protected:
 
     virtual void rc_on_reset();    
 
+    virtual void rc_on_restore_context();
+
     inline bool is_locked() const
         { return m_lock_owner.valid(); }
 
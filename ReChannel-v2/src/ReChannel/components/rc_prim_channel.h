@@ -179,6 +179,15 @@ protected:
         p_constr_done = true;
     }
 
+    /**
+     * @brief Requests an update and marks the channel as modified.
+     */
+    inline void request_update()
+    {
+        this->rc_set_dirty();
+        sc_prim_channel::request_update();
+    }
+
     RC_ON_INIT_RESETTABLE() {}
 
     RC_ON_RESET() {}
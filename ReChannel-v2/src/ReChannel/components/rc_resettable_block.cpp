@@ -0,0 +1,82 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_resettable_block.cpp
+ * @brief   Class rc_resettable_block.
+ */
+
+#include "rc_resettable_block.h"
+
+#include <cstring>
+
+namespace ReChannel {
+
+rc_resettable_block_base::rc_resettable_block_base()
+    : m_reconf(NULL), p_data(NULL), p_reset_data(NULL), p_size(0)
+{
+    rc_reconfigurable* const reconf = rc_get_reconfigurable_context();
+    if (reconf != NULL) {
+        reconf->rc_register_resettable(*this);
+    }
+    m_reconf = reconf;
+}
+
+void rc_resettable_block_base::_rc_init(
+    void* data, void* reset_data, std::size_t size)
+{
+    assert(p_data == NULL);
+
+    p_data = data;
+    p_reset_data = reset_data;
+    p_size = size;
+}
+
+void rc_resettable_block_base::rc_on_init_resettable()
+{
+    // capture the reset image
+    std::memcpy(p_reset_data, p_data, p_size);
+}
+
+void rc_resettable_block_base::rc_on_reset()
+{
+    std::memcpy(p_data, p_reset_data, p_size);
+}
+
+void rc_resettable_block_base::rc_on_save_context()
+{
+    p_context_data.resize(p_size);
+    std::memcpy(&p_context_data[0], p_data, p_size);
+}
+
+void rc_resettable_block_base::rc_on_restore_context()
+{
+    if (p_context_data.size() == p_size) {
+        std::memcpy(p_data, &p_context_data[0], p_size);
+    }
+}
+
+} // namespace ReChannel
+
+//
+// $Id$
+//
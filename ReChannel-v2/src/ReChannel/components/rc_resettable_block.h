@@ -0,0 +1,173 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_resettable_block.h
+ * @brief   Class rc_resettable_block.
+ */
+
+#ifndef RC_RESETTABLE_BLOCK_H_
+#define RC_RESETTABLE_BLOCK_H_
+
+#include "ReChannel/core/rc_common_header.h"
+#include "ReChannel/core/rc_resettable.h"
+#include "ReChannel/core/rc_reconfigurable.h"
+
+#include <boost/type_traits/is_polymorphic.hpp>
+
+namespace ReChannel {
+
+/**
+ * @brief Base class of a resettable block.
+ *
+ * Registers itself once with the current reconfigurable context and
+ * implements the reset as well as the context preservation by copying
+ * the raw memory of the block.
+ */
+class rc_resettable_block_base
+    : virtual public rc_resettable
+{
+protected:
+    rc_resettable_block_base();
+
+    /**
+     * @brief Sets the storage of the block and its reset image.
+     * \attention Has to be called once by the constructor of a subclass.
+     */
+    void _rc_init(void* data, void* reset_data, std::size_t size);
+
+    RC_ON_INIT_RESETTABLE();
+
+    RC_ON_RESET();
+
+    RC_ON_SAVE_CONTEXT();
+
+    RC_ON_RESTORE_CONTEXT();
+
+protected:
+    /** @brief the reconfigurable context (or NULL) */
+    const rc_reconfigurable* m_reconf;
+
+private:
+    void*                      p_data;
+    void*                      p_reset_data;
+    std::size_t                p_size;
+    std::vector<unsigned char> p_context_data;
+
+private:
+    // disabled
+    rc_resettable_block_base(const rc_resettable_block_base& other);
+    rc_resettable_block_base& operator=(
+        const rc_resettable_block_base& other);
+};
+
+/**
+ * @brief A resettable block of plain module state.
+ *
+ * rc_resettable_block<T> holds a value of a trivially copyable type T,
+ * e.g. a struct representing a register bank or a lookup table. In
+ * contrast to rc_var, which registers one resettable per variable, the
+ * whole block is registered only once. Its reset image is captured at the
+ * start of simulation and restored with a single memcpy() on every reset.
+ *
+ * Example:
+ * \code
+ * struct regs_t { int ctrl; int status; int lut[256]; };
+ * rc_resettable_block<regs_t> regs;
+ * [...]
+ * regs->ctrl = 1;
+ * \endcode
+ *
+ * \attention T has to be trivially copyable (e.g. a POD type), since it is
+ * copied bytewise. In particular, T must not contain pointers to
+ * dynamically allocated memory that is owned by the block.
+ *
+ * \see rc_var, rc_resettable
+ */
+template<class T>
+class rc_resettable_block
+    : public rc_resettable_block_base
+{
+    /**
+     * @brief Static assertion to reject types with a virtual table.
+     */
+    RC_STATIC_ASSERT_T(
+        block_type_check, !boost::is_polymorphic<T>::value);
+
+private:
+    typedef rc_resettable_block<T> this_type;
+
+public:
+    typedef T value_type;
+
+public:
+    rc_resettable_block()
+        : rc_resettable_block_base(), m_value(), m_reset_value()
+        { this->_rc_init(&m_value, &m_reset_value, sizeof(T)); }
+
+    explicit rc_resettable_block(const T& value)
+        : rc_resettable_block_base(), m_value(value), m_reset_value(value)
+        { this->_rc_init(&m_value, &m_reset_value, sizeof(T)); }
+
+    inline T& get()
+        { return m_value; }
+
+    inline const T& get() const
+        { return m_value; }
+
+    inline const T& get_reset_value() const
+        { return m_reset_value; }
+
+    inline T& operator*()
+        { return m_value; }
+
+    inline const T& operator*() const
+        { return m_value; }
+
+    inline T* operator->()
+        { return &m_value; }
+
+    inline const T* operator->() const
+        { return &m_value; }
+
+    inline this_type& operator=(const T& value)
+        { m_value = value; return *this; }
+
+    inline operator const T&() const
+        { return m_value; }
+
+protected:
+    T m_value;
+    T m_reset_value;
+
+private:
+    // disabled
+    rc_resettable_block(const this_type& other);
+};
+
+} // namespace ReChannel
+
+#endif // RC_RESETTABLE_BLOCK_H_
+
+//
+// $Id$
+//
@@ -60,6 +60,9 @@ public:
     RC_ON_RESET()
         { p_event.cancel(); }
 
+    RC_ON_SAVE_CONTEXT()
+        { p_event.cancel(); }
+
     inline void notify()
         { p_event.notify(); }
 
@@ -71,6 +71,13 @@ void rc_semaphore::rc_on_reset()
     }
 }
 
+void rc_semaphore::rc_on_restore_context()
+{
+    // the processes holding the semaphore have been cancelled on
+    // deactivation, hence the semaphore value can not be preserved
+    rc_semaphore::rc_on_reset();
+}
+
 int rc_semaphore::wait()
 {
     while(m_value <= 0) {
@@ -71,6 +71,8 @@ protected:
 
     virtual void rc_on_reset();    
 
+    virtual void rc_on_restore_context();
+
 protected:
 
     int      m_value;
@@ -75,6 +75,7 @@ protected:
           m_current_value(rc_undefined_value<T>()),
           m_delta(~0), m_new_value(m_current_value),
           m_reset_value(m_current_value),
+          m_context_value(m_current_value),
           m_notify_value_changed_event(false),
           m_notify_posedge_event(false), m_notify_negedge_event(false),
           m_output_port(0), m_driver_proc(0)
@@ -121,6 +122,9 @@ protected:
         m_reset_value = m_new_value;
     }
 
+    virtual bool rc_is_dirty_tracking() const
+        { return true; }
+
     RC_ON_RESET()
     {
         // reset the signal
@@ -132,11 +136,29 @@ protected:
         }
     }
 
+    RC_ON_SAVE_CONTEXT()
+    {
+        // store signal's current value
+        m_context_value = m_current_value;
+    }
+
+    RC_ON_RESTORE_CONTEXT()
+    {
+        // restore the stored value
+        m_delta = ~0;
+        m_new_value = m_context_value;
+        m_current_value = m_context_value;
+        if (m_notify_value_changed_event) {
+            m_value_changed_event.cancel();
+        }
+    }
+
 protected:
     T             m_current_value;
     sc_dt::uint64 m_delta;
     T             m_new_value;
     T             m_reset_value;
+    T             m_context_value;
 
     mutable bool  m_notify_value_changed_event : 1;
     mutable bool  m_notify_posedge_event       : 1;
@@ -259,6 +281,19 @@ protected:
         }
     }
 
+    RC_ON_RESTORE_CONTEXT()
+    {
+        base_type::rc_on_restore_context();
+
+        // cancel pending edge notifications
+        if (m_notify_negedge_event) {
+            m_negedge_event.cancel();
+        }
+        if (m_notify_posedge_event) {
+            m_posedge_event.cancel();
+        }
+    }
+
 private:
     sc_signal<bool>& _rc_get_reset_signal() const;
 
@@ -332,6 +367,19 @@ protected:
         }
     }
 
+    RC_ON_RESTORE_CONTEXT()
+    {
+        base_type::rc_on_restore_context();
+
+        // cancel pending edge notifications
+        if (m_notify_negedge_event) {
+            m_negedge_event.cancel();
+        }
+        if (m_notify_posedge_event) {
+            m_posedge_event.cancel();
+        }
+    }
+
 protected:
     sc_event m_posedge_event;
     sc_event m_negedge_event;
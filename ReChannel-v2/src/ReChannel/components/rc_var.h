@@ -87,8 +87,13 @@ protected:
 
     template<class P> void init_reset(T& (P::*get_ref)(void));
 
+    template<class P> void save_context(T& (P::*get_ref)(void));
+
+    template<class P> void restore_context(T& (P::*get_ref)(void));
+
 private:
     T m_reset_value;
+    T m_context_value;
 };
 
 /**
@@ -116,12 +121,22 @@ protected:
     virtual void rc_on_init_resettable()
 	    { this->template init_reset<P>(get_ref); }
 
+    virtual void rc_on_save_context()
+	    { this->template save_context<P>(get_ref); }
+
+    virtual void rc_on_restore_context()
+	    { this->template restore_context<P>(get_ref); }
+
 #else // all other compilers
 
 	virtual void rc_on_reset();
 
     virtual void rc_on_init_resettable();
 
+    virtual void rc_on_save_context();
+
+    virtual void rc_on_restore_context();
+
 #endif // (defined(_MSC_VER) && _MSC_VER < 1400)
 };
 
@@ -156,10 +171,25 @@ void resettable_var_b<T>::init_reset(T& (P::*get_ref)(void))
     m_reset_value = (reinterpret_cast<P*>(m_parent)->*get_ref)();
 }
 
+template<class T>
+template<class P>
+void resettable_var_b<T>::save_context(T& (P::*get_ref)(void))
+{
+    m_context_value = (reinterpret_cast<P*>(m_parent)->*get_ref)();
+}
+
+template<class T>
+template<class P>
+void resettable_var_b<T>::restore_context(T& (P::*get_ref)(void))
+{
+    (reinterpret_cast<P*>(m_parent)->*get_ref)() = m_context_value;
+}
+
 // MSVC .NET 2003 compiler bug workaround
 #if (defined(_MSC_VER) && _MSC_VER < 1400) /* Visual Studio .NET 2003 */
 
-/* definition of rc_on_reset() and rc_on_init_resettable moved
+/* definition of rc_on_reset(), rc_on_init_resettable(),
+   rc_on_save_context() and rc_on_restore_context() moved
    to class declaration */
 
 #else // all other compilers
@@ -176,6 +206,18 @@ void resettable_var<P, T, get_ref>::rc_on_init_resettable()
     this->template init_reset<P>(get_ref);
 }
 
+template<class P, class T, T& (P::*get_ref)(void)>
+void resettable_var<P, T, get_ref>::rc_on_save_context()
+{
+    this->template save_context<P>(get_ref);
+}
+
+template<class P, class T, T& (P::*get_ref)(void)>
+void resettable_var<P, T, get_ref>::rc_on_restore_context()
+{
+    this->template restore_context<P>(get_ref);
+}
+
 #endif // (defined(_MSC_VER) && _MSC_VER < 1400)
 
 } // namespace resettable_var
@@ -41,6 +41,12 @@
  * Note: Define RC_DEBUG to enable ReChannel's debug message reporting.
  *       If RC_DEBUG is defined, constant RC_DEBUG_LEVEL sets the
  *          debug level (default is RC_DEBUG_LEVEL=3).
+ *       Define RC_ENABLE_TRACE to enable the binary trace recorder
+ *          (see rc_trace.h).
+ *       Define RC_ENABLE_STATS to enable the hot path counters
+ *          (see rc_stats.h).
+ *       Define RC_ENABLE_PROFILER to enable the sampling wall-clock
+ *          profiler (see rc_profiler.h).
  */
 
 #include <typeinfo>
@@ -135,6 +135,30 @@ void rc_control::deactivate(const rc_reconfigurable_set& reconf_set)
         rc_reconfigurable::ACTIVE);
 }
 
+void rc_control::load(
+    const rc_reconfigurable_set& reconf_set, sc_time& offset)
+{
+    _rc_do_action_at(&rc_control::load, reconf_set, offset);
+}
+
+void rc_control::unload(
+    const rc_reconfigurable_set& reconf_set, sc_time& offset)
+{
+    _rc_do_action_at(&rc_control::unload, reconf_set, offset);
+}
+
+void rc_control::activate(
+    const rc_reconfigurable_set& reconf_set, sc_time& offset)
+{
+    _rc_do_action_at(&rc_control::activate, reconf_set, offset);
+}
+
+void rc_control::deactivate(
+    const rc_reconfigurable_set& reconf_set, sc_time& offset)
+{
+    _rc_do_action_at(&rc_control::deactivate, reconf_set, offset);
+}
+
 void rc_control::move(
     const rc_reconfigurable_set& reconf_set,
     rc_switch_connector_base& target)
@@ -156,6 +180,7 @@ void rc_control::move(
 
 void rc_control::lock(const rc_reconfigurable_set& reconf_set)
 {
+    const sc_time lock_start = sc_time_stamp();
     rc_reconfigurable_set::const_iterator it;
     for(it = reconf_set.begin(); it != reconf_set.end(); ++it) {
         rc_reconfigurable& reconf = *(*it);
@@ -167,7 +192,17 @@ void rc_control::lock(const rc_reconfigurable_set& reconf_set)
                 << reconf.rc_get_name() << "' (in control '"
                 << this->name() << "'");
         }
+        const sc_time reconf_lock_start = sc_time_stamp();
+        const sc_dt::uint64 reconf_lock_delta = sc_delta_count();
         reconf.lock();
+        reconf._rc_add_lock_wait_time(
+            sc_time_stamp() - reconf_lock_start,
+            sc_delta_count() - reconf_lock_delta);
+    }
+    const sc_time lock_time = sc_time_stamp() - lock_start;
+    p_lock_wait_time += lock_time;
+    if (lock_time > p_max_lock_wait_time) {
+        p_max_lock_wait_time = lock_time;
     }
 }
 
@@ -257,6 +292,134 @@ void rc_control::start_of_simulation()
     }
 }
 
+void rc_control::end_of_simulation()
+{
+    if (p_stats_os != NULL) {
+        this->report_statistics(*p_stats_os, p_stats_format);
+    }
+}
+
+void rc_control::set_statistics_report(
+    std::ostream& os, statistics_format format)
+{
+    p_stats_os = &os;
+    p_stats_format = format;
+}
+
+void rc_control::report_statistics(
+    std::ostream& os, statistics_format format) const
+{
+    static const char* const s_state_names[
+        rc_reconfigurable::STATE_COUNT] = {
+        "unloaded", "inactive", "active" };
+    static const char* const s_action_names[
+        rc_reconfigurable::ACTION_COUNT] = {
+        "unload", "load", "activate", "deactivate" };
+
+    const bool is_csv = (format == STATS_CSV);
+    // (switches may be shared by several reconfigurables)
+    std::set<const rc_switch*> reported_switches;
+
+    if (is_csv) {
+        // one value per line: object,metric,value (times in seconds)
+        os << "object,metric,value" << std::endl;
+        os << this->name() << ",lock_wait_time,"
+           << p_lock_wait_time.to_seconds() << std::endl;
+        os << this->name() << ",max_lock_wait_time,"
+           << p_max_lock_wait_time.to_seconds() << std::endl;
+    } else {
+        os << "statistics of control '" << this->name()
+           << "' at " << sc_time_stamp() << std::endl;
+        os << "  lock wait time: " << p_lock_wait_time
+           << " (max " << p_max_lock_wait_time << ")" << std::endl;
+    }
+
+    rc_reconfigurable_set::const_iterator it;
+    for(it = p_reconfigurable_set.begin();
+        it != p_reconfigurable_set.end();
+        ++it)
+    {
+        const rc_reconfigurable& reconf = *(*it);
+        const std::string reconf_name = reconf.rc_get_name();
+
+        if (is_csv) {
+            for (int i=0; i < rc_reconfigurable::STATE_COUNT; i++) {
+                os << reconf_name << ",time_" << s_state_names[i] << ","
+                   << reconf.rc_get_state_time(
+                          (rc_reconfigurable::state_type)i).to_seconds()
+                   << std::endl;
+            }
+            for (int i=0; i < rc_reconfigurable::ACTION_COUNT; i++) {
+                os << reconf_name << ",count_" << s_action_names[i] << ","
+                   << reconf.rc_get_action_count(
+                          (rc_reconfigurable::action_type)i)
+                   << std::endl;
+            }
+            os << reconf_name << ",drain_wait_time,"
+               << reconf.rc_get_drain_wait_time().to_seconds()
+               << std::endl;
+            os << reconf_name << ",max_drain_wait_time,"
+               << reconf.rc_get_max_drain_wait_time().to_seconds()
+               << std::endl;
+            os << reconf_name << ",lock_wait_time,"
+               << reconf.rc_get_lock_wait_time().to_seconds()
+               << std::endl;
+            os << reconf_name << ",max_lock_wait_time,"
+               << reconf.rc_get_max_lock_wait_time().to_seconds()
+               << std::endl;
+            os << reconf_name << ",preemption_count,"
+               << reconf.rc_get_preemption_count() << std::endl;
+        } else {
+            os << "  reconfigurable '" << reconf_name << "':"
+               << std::endl;
+            for (int i=0; i < rc_reconfigurable::STATE_COUNT; i++) {
+                os << "    time " << s_state_names[i] << ": "
+                   << reconf.rc_get_state_time(
+                          (rc_reconfigurable::state_type)i)
+                   << std::endl;
+            }
+            for (int i=0; i < rc_reconfigurable::ACTION_COUNT; i++) {
+                os << "    count " << s_action_names[i] << ": "
+                   << reconf.rc_get_action_count(
+                          (rc_reconfigurable::action_type)i)
+                   << std::endl;
+            }
+            os << "    drain wait time: "
+               << reconf.rc_get_drain_wait_time()
+               << " (max " << reconf.rc_get_max_drain_wait_time() << ")"
+               << std::endl;
+            os << "    lock wait time: "
+               << reconf.rc_get_lock_wait_time()
+               << " (max " << reconf.rc_get_max_lock_wait_time() << ")"
+               << std::endl;
+            os << "    preemptions: "
+               << reconf.rc_get_preemption_count() << std::endl;
+        }
+
+        // the transaction counts of the registered switches
+        rc_reconfigurable::switch_commobj_index::const_iterator sw_it;
+        for(sw_it = reconf.p_switch_commobj_index.begin();
+            sw_it != reconf.p_switch_commobj_index.end();
+            ++sw_it)
+        {
+            const rc_switch& switch_obj = *(sw_it->first);
+            if (is_csv) {
+                if (!reported_switches.insert(&switch_obj).second) {
+                    continue;
+                }
+                os << switch_obj.get_switch_name() << ",transaction_count,"
+                   << switch_obj.get_total_transaction_count()
+                   << std::endl;
+            } else {
+                os << "    " << switch_obj.get_switch_kind() << " '"
+                   << switch_obj.get_switch_name() << "': "
+                   << switch_obj.get_total_transaction_count()
+                   << " transactions" << std::endl;
+            }
+        }
+    }
+}
+
 void rc_control::_rc_unlock(
     rc_reconfigurable_set::const_iterator start_,
     rc_reconfigurable_set::const_iterator end_) const
@@ -326,6 +489,9 @@ void rc_control::_rc_reconfigure(
         } else {
             typedef std::vector<sc_process_handle> proc_vector_type;
             proc_vector_type procs;
+            // (the spawned processes start at the local time of the caller)
+            const sc_time offset = rc_local_time::get_offset();
+            std::vector<sc_time> end_times(reconf_set.size());
             rc_reconfigurable_set::const_iterator it;
             for(it = reconf_set.begin(); it != reconf_set.end(); ++it) {
                 rc_reconfigurable& reconf = *(*it);
@@ -333,8 +499,9 @@ void rc_control::_rc_reconfigure(
                     sc_process_handle proc =
                         sc_spawn(
                             sc_bind(
-                                &rc_reconfigurable::reconfigure,
-                                &reconf, new_state));
+                                &rc_control::_rc_reconfigure_proc,
+                                &reconf, new_state, offset,
+                                &end_times[procs.size()]));
                     reconf.share_lock(proc);
                     procs.push_back(proc);
                 }
@@ -347,11 +514,19 @@ void rc_control::_rc_reconfigure(
                         (*procs.begin()).terminated_event()
                         & (*(++procs.begin())).terminated_event();
                     proc_vector_type::iterator it;
-                    for(it = procs.begin() + 3; it != procs.end(); ++it) {
+                    for(it = procs.begin() + 2; it != procs.end(); ++it) {
                         event_and_list & (*it).terminated_event();
                     }
                     ::sc_core::wait(event_and_list);
                 }
+                // continue at the latest local time of the processes
+                sc_time end_time = sc_time_stamp();
+                for (unsigned int i=0; i < procs.size(); i++) {
+                    if (end_times[i] > end_time) {
+                        end_time = end_times[i];
+                    }
+                }
+                rc_local_time::set_offset(end_time - sc_time_stamp());
             }
         }
     } else {
@@ -364,6 +539,27 @@ void rc_control::_rc_reconfigure(
     }
 }
 
+void rc_control::_rc_do_action_at(
+    void (rc_control::*action)(const rc_reconfigurable_set&),
+    const rc_reconfigurable_set& reconf_set, sc_time& offset)
+{
+    rc_local_time::set_offset(offset);
+    (this->*action)(reconf_set);
+    offset = rc_local_time::get_offset();
+    rc_local_time::set_offset(SC_ZERO_TIME);
+}
+
+void rc_control::_rc_reconfigure_proc(
+    rc_reconfigurable* reconf, rc_reconfigurable::state_type new_state,
+    sc_time start_offset, sc_time* end_time)
+{
+    rc_local_time::set_offset(start_offset);
+    reconf->reconfigure(new_state);
+    // (the offset is handed over instead of being dropped on termination)
+    *end_time = rc_local_time::get_current_time();
+    rc_local_time::set_offset(SC_ZERO_TIME);
+}
+
 } // namespace ReChannel
 
 //
@@ -57,8 +57,15 @@ class rc_control
 private:
     typedef std::map<sc_object*, rc_reconfigurable*> obj_reconf_map;
 
+public:
+    /**
+     * @brief The output formats of the statistics report.
+     */
+    enum statistics_format { STATS_TEXT=0, STATS_CSV };
+
 public:
     rc_control(sc_module_name name_=sc_gen_unique_name("rc_control"))
+        : p_stats_os(NULL), p_stats_format(STATS_TEXT)
     { }
 
     virtual bool has_control(
@@ -76,6 +83,37 @@ public:
 
     virtual void deactivate(const rc_reconfigurable_set& reconf_set);
 
+    /**
+     * @brief Loads the set at the given local time offset.
+     *
+     * The offset is the local time offset of the calling process, e.g.
+     * the local time of its tlm_utils::tlm_quantumkeeper. The delays of
+     * temporally decoupled reconfigurables are added to the offset, which
+     * is returned to the caller.
+     *
+     * \see rc_local_time, rc_reconfigurable::rc_set_temporal_decoupling()
+     */
+    void load(const rc_reconfigurable_set& reconf_set, sc_time& offset);
+
+    /**
+     * @brief Unloads the set at the given local time offset.
+     * \see load(const rc_reconfigurable_set&, sc_time&)
+     */
+    void unload(const rc_reconfigurable_set& reconf_set, sc_time& offset);
+
+    /**
+     * @brief Activates the set at the given local time offset.
+     * \see load(const rc_reconfigurable_set&, sc_time&)
+     */
+    void activate(const rc_reconfigurable_set& reconf_set, sc_time& offset);
+
+    /**
+     * @brief Deactivates the set at the given local time offset.
+     * \see load(const rc_reconfigurable_set&, sc_time&)
+     */
+    void deactivate(
+        const rc_reconfigurable_set& reconf_set, sc_time& offset);
+
     virtual void lock(const rc_reconfigurable_set& reconf_set);
 
     virtual bool trylock(const rc_reconfigurable_set& reconf_set);
@@ -88,6 +126,39 @@ public:
         const rc_reconfigurable_set& reconf_set,
         rc_switch_connector_base& target);
 
+    /**
+     * @brief Returns the accumulated time spent waiting in lock().
+     */
+    sc_time get_lock_wait_time() const
+        { return p_lock_wait_time; }
+
+    /**
+     * @brief Returns the longest time spent waiting in a single lock().
+     */
+    sc_time get_max_lock_wait_time() const
+        { return p_max_lock_wait_time; }
+
+    /**
+     * @brief Writes the statistics of the controlled reconfigurables.
+     *
+     * The report contains the state times, action counts, drain and
+     * lock wait times of each controlled reconfigurable and the total
+     * transaction counts of their switches.
+     *
+     * \see rc_reconfigurable::rc_get_state_time(),
+     *      rc_switch::get_total_transaction_count()
+     */
+    void report_statistics(
+        std::ostream& os, statistics_format format=STATS_TEXT) const;
+
+    /**
+     * @brief Writes the statistics report at the end of simulation.
+     *
+     * \remark The stream has to exist until the end of simulation.
+     */
+    void set_statistics_report(
+        std::ostream& os, statistics_format format=STATS_TEXT);
+
 protected:
 
     virtual sc_time takes_time(
@@ -100,6 +171,8 @@ protected:
 
     virtual void start_of_simulation();
 
+    virtual void end_of_simulation();
+
 private:
     /* for internal use only */
 
@@ -123,10 +196,34 @@ private:
         const rc_reconfigurable_set& reconf_set,
         rc_reconfigurable::state_type new_state);
 
+    /**
+     * @brief Performs an action at the caller's local time offset
+     *        (internal only)
+     */
+    void _rc_do_action_at(
+        void (rc_control::*action)(const rc_reconfigurable_set&),
+        const rc_reconfigurable_set& reconf_set, sc_time& offset);
+
+    /**
+     * @brief Reconfigures a single reconfigurable in a process of its own
+     *        (internal only)
+     *
+     * The process starts at the local time offset of its spawner and
+     * returns its local time on termination.
+     */
+    static void _rc_reconfigure_proc(
+        rc_reconfigurable* reconf, rc_reconfigurable::state_type new_state,
+        sc_time start_offset, sc_time* end_time);
+
 private:
     rc_reconfigurable_set p_reconfigurable_set;
     obj_reconf_map        p_obj_reconf_map;
 
+    sc_time               p_lock_wait_time;
+    sc_time               p_max_lock_wait_time;
+    std::ostream*         p_stats_os;
+    statistics_format     p_stats_format;
+
 private:
     // disabled
     rc_control(const rc_control& orig);
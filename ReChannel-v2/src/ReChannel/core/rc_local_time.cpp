@@ -0,0 +1,128 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_local_time.cpp
+ * @brief   Class rc_local_time
+ */
+
+#include <cmath>
+
+#include "rc_local_time.h"
+
+namespace ReChannel {
+
+sc_time rc_local_time::s_global_quantum = SC_ZERO_TIME;
+
+const sc_time* rc_local_time::s_global_quantum_ref =
+    &rc_local_time::s_global_quantum;
+
+rc_local_time::offset_map rc_local_time::s_offset_map;
+
+unsigned int rc_local_time::s_sweep_size = 64;
+
+sc_time rc_local_time::get_offset()
+{
+    offset_map::const_iterator it = s_offset_map.find(
+        sc_get_current_process_handle().get_process_object());
+    return (it != s_offset_map.end() ? it->second.offset : SC_ZERO_TIME);
+}
+
+void rc_local_time::set_offset(const sc_time& t)
+{
+    if (t != SC_ZERO_TIME) {
+        _rc_get_current_entry().offset = t;
+    } else {
+        // only decoupled processes occupy an entry
+        s_offset_map.erase(
+            sc_get_current_process_handle().get_process_object());
+    }
+}
+
+void rc_local_time::inc(const sc_time& t)
+{
+    if (t != SC_ZERO_TIME) {
+        _rc_get_current_entry().offset += t;
+    }
+}
+
+bool rc_local_time::need_sync()
+{
+    const sc_time offset = get_offset();
+    const sc_time& quantum = get_global_quantum();
+    if (quantum == SC_ZERO_TIME) {
+        return (offset != SC_ZERO_TIME);
+    }
+    // the next quantum boundary (as in the TLM 2.0 quantum keeper)
+    const sc_time now = sc_time_stamp();
+    const double quantum_count = std::floor(now / quantum);
+    const sc_time boundary = quantum * (quantum_count + 1.0);
+    return (now + offset >= boundary);
+}
+
+void rc_local_time::sync(const sc_time& delay, bool is_delta_sync)
+{
+    const sc_time t = get_offset() + delay;
+    set_offset(SC_ZERO_TIME);
+    if (t != SC_ZERO_TIME || is_delta_sync) {
+        ::sc_core::wait(t);
+    }
+}
+
+rc_local_time::offset_entry& rc_local_time::_rc_get_current_entry()
+{
+    const sc_process_handle proc = sc_get_current_process_handle();
+    sc_object* const proc_obj = proc.get_process_object();
+    offset_map::iterator it = s_offset_map.find(proc_obj);
+    if (it == s_offset_map.end()) {
+        // (a terminated process may have left a non-zero offset behind)
+        if (s_offset_map.size() >= s_sweep_size) {
+            _rc_sweep_terminated();
+        }
+        it = s_offset_map.insert(
+            offset_map::value_type(proc_obj, offset_entry())).first;
+        it->second.proc = proc;
+    }
+    return it->second;
+}
+
+void rc_local_time::_rc_sweep_terminated()
+{
+    offset_map::iterator it = s_offset_map.begin();
+    while (it != s_offset_map.end()) {
+        if (it->second.proc.terminated()) {
+            s_offset_map.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+    // (amortises the sweeps over the insertions)
+    if (s_offset_map.size() * 2 >= s_sweep_size) {
+        s_sweep_size = s_offset_map.size() * 2;
+    }
+}
+
+} // namespace ReChannel
+
+//
+// $Id$
+//
@@ -0,0 +1,142 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_local_time.h
+ * @brief   Class rc_local_time
+ */
+
+#ifndef RC_LOCAL_TIME_H_
+#define RC_LOCAL_TIME_H_
+
+#include "ReChannel/core/rc_common_header.h"
+
+namespace ReChannel {
+
+/**
+ * @brief Class rc_local_time
+ *
+ * rc_local_time manages the local time offsets of temporally decoupled
+ * processes. A process may run ahead of the simulation time by its local
+ * time offset. It has to synchronise with the kernel only if its local
+ * time reaches the next quantum boundary.
+ *
+ * The offsets are kept per process. Processes that are not decoupled
+ * always have an offset of zero. The entries of processes that have
+ * terminated are swept when the table has grown.
+ *
+ * If ReChannel/tlm.h is included, the quantum of
+ * tlm::tlm_global_quantum is used, i.e. the quantum is shared with the
+ * TLM 2.0 quantum keepers. A process that keeps its local time in a
+ * tlm_utils::tlm_quantumkeeper hands it over by the rc_control methods
+ * that take an offset.
+ *
+ * \see rc_reconfigurable::rc_set_temporal_decoupling(),
+ *      rc_control::load(const rc_reconfigurable_set&, sc_time&)
+ */
+class rc_local_time
+{
+private:
+    /** @brief an entry of the offset table (internal only) */
+    struct offset_entry
+    {
+        // (keeps the process object from being reused)
+        sc_process_handle proc;
+        sc_time           offset;
+    };
+
+    typedef std::map<sc_object*, offset_entry> offset_map;
+
+public:
+    /**
+     * @brief sets the global quantum (SC_ZERO_TIME: no decoupling)
+     * \note Has no effect if the quantum is bound to another one.
+     */
+    static void set_global_quantum(const sc_time& t)
+        { s_global_quantum = t; }
+
+    /**
+     * @brief uses the given quantum as the global quantum
+     * \remark The quantum has to exist as long as the simulation.
+     * \see ReChannel/tlm.h
+     */
+    static void bind_global_quantum(const sc_time& quantum)
+        { s_global_quantum_ref = &quantum; }
+
+    /** @brief returns the global quantum */
+    static const sc_time& get_global_quantum()
+        { return *s_global_quantum_ref; }
+
+    /** @brief returns the local time offset of the current process */
+    static sc_time get_offset();
+
+    /** @brief sets the local time offset of the current process */
+    static void set_offset(const sc_time& t);
+
+    /** @brief increments the local time offset of the current process */
+    static void inc(const sc_time& t);
+
+    /** @brief returns the local time of the current process */
+    static sc_time get_current_time()
+        { return sc_time_stamp() + get_offset(); }
+
+    /** @brief has the local time reached the next quantum boundary? */
+    static bool need_sync();
+
+    /**
+     * @brief synchronises the current process with the kernel.
+     *
+     * Waits for the local time offset plus the given delay and resets the
+     * offset. At least one delta cycle is waited if both are zero and
+     * is_delta_sync is set.
+     */
+    static void sync(
+        const sc_time& delay=SC_ZERO_TIME, bool is_delta_sync=false);
+
+private:
+    /** @brief returns the entry of the current process (internal only) */
+    static offset_entry& _rc_get_current_entry();
+
+    /** @brief drops the entries of terminated processes (internal only) */
+    static void _rc_sweep_terminated();
+
+private:
+    static sc_time        s_global_quantum;
+    static const sc_time* s_global_quantum_ref;
+    static offset_map     s_offset_map;
+    // (the table size at which terminated entries are swept)
+    static unsigned int s_sweep_size;
+
+private:
+    // disabled
+    rc_local_time();
+    rc_local_time(const rc_local_time& orig);
+    rc_local_time& operator=(const rc_local_time& orig);
+};
+
+} // namespace ReChannel
+
+#endif // RC_LOCAL_TIME_H_
+
+//
+// $Id$
+//
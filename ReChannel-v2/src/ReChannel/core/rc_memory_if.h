@@ -0,0 +1,118 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_memory_if.h
+ * @brief   Interface rc_memory_if.
+ *
+ * \see ReChannel::rc_memory_if, ReChannel::rc_memory
+ */
+
+#ifndef RC_MEMORY_IF_H_
+#define RC_MEMORY_IF_H_
+
+#include "ReChannel/core/rc_common_header.h"
+
+namespace ReChannel {
+
+/**
+ * @brief The pure virtual interface of a memory.
+ *
+ * rc_memory_if provides word-addressed, non-blocking access to a memory of
+ * data type T. Besides single and burst accesses, a direct pointer to the
+ * memory contents may be requested for fast functional access.
+ *
+ * \remark None of the methods consumes simulation time or notifies any
+ *         events. Timing has to be modelled by the caller.
+ *
+ * \see rc_memory
+ */
+template<class T>
+class rc_memory_if
+    : virtual public sc_interface
+{
+public:
+    /** @brief the type of a memory word */
+    typedef T             data_type;
+    /** @brief the type of a word address */
+    typedef sc_dt::uint64 address_type;
+
+public:
+    /**
+     * @brief Returns the size of the memory (in words).
+     */
+    virtual address_type size() const = 0;
+
+    /**
+     * @brief Reads a single word.
+     */
+    virtual T read(address_type addr) const = 0;
+
+    /**
+     * @brief Writes a single word.
+     */
+    virtual void write(address_type addr, const T& value) = 0;
+
+    /**
+     * @brief Reads count consecutive words starting at addr.
+     */
+    virtual void burst_read(
+        address_type addr, T* data, unsigned int count) const = 0;
+
+    /**
+     * @brief Writes count consecutive words starting at addr.
+     */
+    virtual void burst_write(
+        address_type addr, const T* data, unsigned int count) = 0;
+
+    /**
+     * @brief Returns a pointer for direct read access.
+     * @param addr the address of the first word
+     * @param count returns the number of contiguous words accessible
+     *              through the returned pointer
+     * @return the pointer or NULL if direct access is not possible
+     *
+     * \attention The pointer is invalidated by the next write access to
+     *            the same memory region and by any reset of the memory.
+     */
+    virtual const T* get_read_ptr(
+        address_type addr, unsigned int& count) const = 0;
+
+    /**
+     * @brief Returns a pointer for direct read/write access.
+     * @param addr the address of the first word
+     * @param count returns the number of contiguous words accessible
+     *              through the returned pointer
+     * @return the pointer or NULL if direct access is not possible
+     *
+     * \attention The pointer is invalidated by any reset of the memory.
+     */
+    virtual T* get_write_ptr(address_type addr, unsigned int& count) = 0;
+};
+
+} // namespace ReChannel
+
+#endif // RC_MEMORY_IF_H_
+
+//
+// $Id$
+//
@@ -0,0 +1,117 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_phase_profile.cpp
+ * @brief   Classes rc_phase_record and rc_phase_profile
+ */
+
+#include "rc_phase_profile.h"
+
+namespace ReChannel {
+
+rc_phase_record::rc_phase_record()
+{
+    this->clear();
+}
+
+void rc_phase_record::clear()
+{
+    start_time = SC_ZERO_TIME;
+    for (int i=0; i < PHASE_COUNT; i++) {
+        phase_time[i] = SC_ZERO_TIME;
+        phase_deltas[i] = 0;
+    }
+}
+
+sc_time rc_phase_record::get_total_time() const
+{
+    sc_time total = SC_ZERO_TIME;
+    for (int i=0; i < PHASE_COUNT; i++) {
+        total += phase_time[i];
+    }
+    return total;
+}
+
+sc_dt::uint64 rc_phase_record::get_total_deltas() const
+{
+    sc_dt::uint64 total = 0;
+    for (int i=0; i < PHASE_COUNT; i++) {
+        total += phase_deltas[i];
+    }
+    return total;
+}
+
+const char* rc_phase_record::get_phase_name(phase_type phase)
+{
+    static const char* const s_phase_names[PHASE_COUNT] = {
+        "lock", "lock_switches", "delay", "delta_sync", "reset",
+        "callback" };
+
+    if ((int)phase < 0 || (int)phase >= PHASE_COUNT) {
+        return "(unknown)";
+    }
+    return s_phase_names[phase];
+}
+
+void rc_phase_profile::add(const rc_phase_record& record)
+{
+    for (int i=0; i < rc_phase_record::PHASE_COUNT; i++) {
+        p_time_histograms[i].add(record.phase_time[i].value());
+        p_delta_histograms[i].add(record.phase_deltas[i]);
+    }
+    p_total_time_histogram.add(record.get_total_time().value());
+}
+
+void rc_phase_profile::clear()
+{
+    for (int i=0; i < rc_phase_record::PHASE_COUNT; i++) {
+        p_time_histograms[i].clear();
+        p_delta_histograms[i].clear();
+    }
+    p_total_time_histogram.clear();
+}
+
+void rc_phase_profile::print(std::ostream& os) const
+{
+    const sc_time resolution = sc_get_time_resolution();
+
+    os << "reconfigurations: " << this->get_count() << std::endl;
+    for (int i=0; i < rc_phase_record::PHASE_COUNT; i++) {
+        const rc_histogram& th = p_time_histograms[i];
+        const rc_histogram& dh = p_delta_histograms[i];
+        os << "  " << rc_phase_record::get_phase_name((phase_type)i)
+           << ": time mean " << resolution * th.get_mean()
+           << ", max " << resolution * (double)th.get_max()
+           << ", p90 <= " << resolution * (double)th.get_percentile(0.9)
+           << "; deltas mean " << dh.get_mean()
+           << ", max " << dh.get_max()
+           << ", p90 <= " << dh.get_percentile(0.9)
+           << std::endl;
+    }
+}
+
+} // namespace ReChannel
+
+//
+// $Id$
+//
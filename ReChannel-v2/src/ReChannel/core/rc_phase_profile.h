@@ -0,0 +1,226 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_phase_profile.h
+ * @brief   Classes rc_phase_record and rc_phase_profile
+ */
+
+#ifndef RC_PHASE_PROFILE_H_
+#define RC_PHASE_PROFILE_H_
+
+#include "ReChannel/core/rc_common_header.h"
+#include "ReChannel/core/rc_local_time.h"
+#include "ReChannel/util/rc_histogram.h"
+
+namespace ReChannel {
+
+/**
+ * @brief The phase breakdown of a single reconfiguration.
+ *
+ * A record is filled by each call of rc_reconfigurable::reconfigure().
+ * It stores the simulated time and the number of delta cycles spent in
+ * each of the phases of the reconfiguration. If the reconfiguration
+ * consists of several actions (e.g. load and activate) the phases of all
+ * actions are accumulated.
+ *
+ * \see rc_reconfigurable::rc_get_last_phase_record()
+ */
+class rc_phase_record
+{
+public:
+
+    /**
+     * @brief The phases of a reconfiguration.
+     *
+     * - LOCK_PHASE: acquiring the lock on the reconfigurable
+     * - SWITCH_LOCK_PHASE: locking the switches
+     * - DELAY_PHASE: the delays of the actions
+     *   (see rc_control::takes_time())
+     * - DELTA_SYNC_PHASE: waiting for the delta-synchronised state change
+     *   (includes the draining of pending transactions on deactivation)
+     * - RESET_PHASE: resetting (or saving/restoring) the resettables
+     * - CALLBACK_PHASE: the user callbacks rc_on_load(), rc_on_activate(),
+     *   rc_on_deactivate() and rc_on_unload()
+     */
+    enum phase_type {
+        LOCK_PHASE=0, SWITCH_LOCK_PHASE, DELAY_PHASE, DELTA_SYNC_PHASE,
+        RESET_PHASE, CALLBACK_PHASE
+    };
+
+    /**
+     * @brief The number of phases.
+     */
+    enum { PHASE_COUNT=6 };
+
+public:
+    rc_phase_record();
+
+    /**
+     * @brief Resets all phases to zero.
+     */
+    void clear();
+
+    /**
+     * @brief The total time spent in all phases.
+     */
+    sc_time get_total_time() const;
+
+    /**
+     * @brief The total number of delta cycles spent in all phases.
+     */
+    sc_dt::uint64 get_total_deltas() const;
+
+    /**
+     * @brief Returns the name of the given phase.
+     */
+    static const char* get_phase_name(phase_type phase);
+
+public:
+    /** @brief the simulation time the reconfiguration started at */
+    sc_time       start_time;
+    /** @brief the time spent in each phase */
+    sc_time       phase_time[PHASE_COUNT];
+    /** @brief the number of delta cycles spent in each phase */
+    sc_dt::uint64 phase_deltas[PHASE_COUNT];
+};
+
+/**
+ * @brief Histograms of the phases of all recorded reconfigurations.
+ *
+ * For each phase two histograms are maintained, one for the time (in
+ * units of the time resolution) and one for the number of delta cycles.
+ *
+ * \see rc_reconfigurable::rc_get_phase_profile(), rc_histogram
+ */
+class rc_phase_profile
+{
+private:
+    typedef rc_phase_record::phase_type phase_type;
+
+public:
+    rc_phase_profile() {}
+
+    /**
+     * @brief Adds the phases of the given record to the histograms.
+     */
+    void add(const rc_phase_record& record);
+
+    /**
+     * @brief Removes all recorded samples.
+     */
+    void clear();
+
+    /**
+     * @brief The number of recorded reconfigurations.
+     */
+    inline unsigned long get_count() const
+        { return p_total_time_histogram.get_count(); }
+
+    /**
+     * @brief The time histogram of the given phase.
+     *
+     * The samples are given in units of the time resolution.
+     */
+    inline const rc_histogram& get_time_histogram(phase_type phase) const
+        { return p_time_histograms[phase]; }
+
+    /**
+     * @brief The delta cycle histogram of the given phase.
+     */
+    inline const rc_histogram& get_delta_histogram(phase_type phase) const
+        { return p_delta_histograms[phase]; }
+
+    /**
+     * @brief The histogram of the total time of the reconfigurations.
+     */
+    inline const rc_histogram& get_total_time_histogram() const
+        { return p_total_time_histogram; }
+
+    /**
+     * @brief Writes a summary of all phases to the given stream.
+     *
+     * For each phase the mean, the maximum and the 90th percentile of
+     * the time and the delta cycles are written.
+     */
+    void print(std::ostream& os) const;
+
+private:
+    rc_histogram p_time_histograms[rc_phase_record::PHASE_COUNT];
+    rc_histogram p_delta_histograms[rc_phase_record::PHASE_COUNT];
+    rc_histogram p_total_time_histogram;
+};
+
+namespace internals {
+
+/**
+ * @brief Accounts the time and delta cycles of its scope to a phase.
+ *
+ * If local_time is true, the time is measured at the local time of the
+ * current process (see rc_local_time), i.e. it includes the local time
+ * offset consumed by a temporally decoupled process.
+ */
+class phase_stopwatch
+{
+public:
+    phase_stopwatch(
+        rc_phase_record& record, rc_phase_record::phase_type phase,
+        bool local_time=false)
+        : p_record(record), p_phase(phase), p_local_time(local_time),
+          p_start_time(get_time()), p_start_delta(sc_delta_count())
+    { }
+
+    ~phase_stopwatch()
+    {
+        p_record.phase_time[p_phase] += get_time() - p_start_time;
+        p_record.phase_deltas[p_phase] += sc_delta_count() - p_start_delta;
+    }
+
+private:
+    inline sc_time get_time() const
+    {
+        return (p_local_time
+            ? rc_local_time::get_current_time() : sc_time_stamp());
+    }
+
+private:
+    rc_phase_record&            p_record;
+    rc_phase_record::phase_type p_phase;
+    bool                        p_local_time;
+    sc_time                     p_start_time;
+    sc_dt::uint64               p_start_delta;
+
+private:
+    // disabled
+    phase_stopwatch(const phase_stopwatch& orig);
+    phase_stopwatch& operator=(const phase_stopwatch& orig);
+};
+
+} // namespace internals
+
+} // namespace ReChannel
+
+#endif // RC_PHASE_PROFILE_H_
+
+//
+// $Id$
+//
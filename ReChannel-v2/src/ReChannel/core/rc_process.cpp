@@ -42,7 +42,7 @@ rc_process_control::rc_process_control(
     bool is_initially_active, bool deactivate_silently)
 :  p_activation_delta(0), p_cancel_flag(!is_initially_active),
    p_cancel_delta(0), p_deactivate_silently(deactivate_silently),
-   p_parent(NULL)
+   p_epoch(0), p_parent_epoch(0), p_parent(NULL)
 { }
 
 rc_process_control::rc_process_control(
@@ -50,7 +50,7 @@ rc_process_control::rc_process_control(
     bool deactivate_silently)
 :  p_activation_delta(0), p_cancel_flag(!is_initially_active),
    p_cancel_delta(0), p_deactivate_silently(deactivate_silently),
-   p_parent(&parent)
+   p_epoch(0), p_parent_epoch(parent.p_epoch), p_parent(&parent)
 {
     parent.p_child_set.insert(this);
 }
@@ -65,6 +65,7 @@ rc_process_control::~rc_process_control()
         ++it)
     {
         (*it)->p_parent = NULL;
+        (*it)->p_cancel_flag = true;
     }
 }
 
@@ -75,6 +76,10 @@ void rc_process_control::activate()
         p_activation_delta = sc_delta_count();
     }
     p_cancel_flag = false;
+    if (p_parent != NULL) {
+        // (a dependent is activated within the parent's current epoch)
+        p_parent_epoch = p_parent->p_epoch;
+    }
 
     // activate dependent process controls
     for (pctrl_set::iterator it=p_child_set.begin();
@@ -95,18 +100,8 @@ void rc_process_control::deactivate()
     }
     p_cancel_flag = true;
 
-    // deactivate dependent process controls
-    for (pctrl_set::iterator it=p_child_set.begin();
-        it != p_child_set.end();
-        ++it)
-    {
-        rc_process_control* const pctrl = *it;
-        pctrl->deactivate();
-        if (pctrl->p_deactivate_silently) {
-            //pctrl->p_cancel_event.notify(SC_ZERO_TIME);
-            rc_notify(pctrl->p_cancel_event);
-        }
-    }
+    // cancel the dependent process controls (without visiting them)
+    ++p_epoch;
 }
 
 const sc_event rc_process_handle::s_never_notified;
@@ -133,9 +128,8 @@ rc_process_handle rc_process_registry::get_process_handle(
 rc_process_handle rc_process_registry::register_process(
     const sc_process_handle& hproc)
 {
-    if ((p_process_map.size() % gc_interval) == 0) {
-        this->gc();
-    }
+    this->_rc_reclaim(reclaim_batch_size);
+
     rc_process_info& pinfo = p_process_map[hproc.get_process_object()];
     pinfo.ref_count = 0;
     pinfo.handle = hproc;
@@ -143,10 +137,11 @@ rc_process_handle rc_process_registry::register_process(
     pinfo.is_cancelable = false;
     pinfo.is_terminated = false;
     pinfo.is_temporary = false;
-    pinfo.cancel_event = NULL;
-    pinfo.cancel_flag = NULL;
-    pinfo.cancel_delta = NULL;
-    pinfo.terminated_event = NULL;
+    pinfo.process_control = NULL;
+    if (pinfo.terminated_event != NULL) {
+        this->_rc_free_event(pinfo.terminated_event);
+        pinfo.terminated_event = NULL;
+    }
     return rc_process_handle(pinfo);
 }
 
@@ -155,9 +150,8 @@ rc_process_handle rc_process_registry::register_process(
     bool dont_initialize, bool is_cancelable,
     const rc_process_control& pctrl, bool is_temporary)
 {
-    if ((p_process_map.size() % gc_interval) == 0) {
-        this->gc();
-    }
+    this->_rc_reclaim(reclaim_batch_size);
+
     rc_process_info& pinfo = p_process_map[hproc.get_process_object()];
     pinfo.ref_count = 0;
     pinfo.handle = hproc;
@@ -165,51 +159,64 @@ rc_process_handle rc_process_registry::register_process(
     pinfo.is_cancelable = is_cancelable;
     pinfo.is_terminated = false;
     pinfo.is_temporary = is_temporary;
-    pinfo.cancel_event = &pctrl.p_cancel_event;
-    pinfo.cancel_flag = &pctrl.p_cancel_flag;
-    pinfo.cancel_delta = &pctrl.p_cancel_delta;
-    pinfo.terminated_event = new sc_event(); // will be deleted by gc()
+    pinfo.process_control = &pctrl;
+    if (pinfo.terminated_event == NULL) {
+        // (an idle worker thread keeps its event on reuse)
+        pinfo.terminated_event = this->_rc_alloc_event();
+    }
     return rc_process_handle(pinfo);
 }
 
-rc_process_handle rc_process_registry::register_process(
-    const sc_process_handle& hproc,
-    bool dont_initialize, bool is_cancelable,
-    const sc_event* cancel_event, const bool* cancel_flag,
-    const sc_dt::uint64* cancel_delta, bool is_temporary)
+void rc_process_registry::gc()
 {
-    if ((p_process_map.size() % gc_interval) == 0) {
-        this->gc();
-    }
-    rc_process_info& pinfo = p_process_map[hproc.get_process_object()];
-    pinfo.ref_count = 0;
-    pinfo.handle = hproc;
-    pinfo.dont_initialize = dont_initialize;
-    pinfo.is_cancelable = is_cancelable;
-    pinfo.is_terminated = false;
-    pinfo.is_temporary = is_temporary;
-    pinfo.cancel_event = cancel_event;
-    pinfo.cancel_flag = cancel_flag;
-    pinfo.cancel_delta = cancel_delta;
-    pinfo.terminated_event = new sc_event(); // will be deleted by gc()
-    return rc_process_handle(pinfo);
+    this->_rc_reclaim(p_release_list.size());
 }
 
-void rc_process_registry::gc()
+void rc_process_registry::_rc_reclaim(unsigned int max_count)
 {
-    for(process_map::iterator it = p_process_map.begin();
-        it != p_process_map.end();
-        ++it)
-    {
-        rc_process_info& pinfo = it->second;
-        // delete process if it is unreferenced and physically terminated
-        if (pinfo.ref_count == 0 && pinfo.handle.terminated()) {
+    // note: each entry is examined at most once per call
+    if (max_count > p_release_list.size()) {
+        max_count = p_release_list.size();
+    }
+    for (unsigned int i = 0; i < max_count; ++i) {
+        rc_process_info& pinfo = *p_release_list.front();
+        p_release_list.pop_front();
+        if (pinfo.ref_count > 0) {
+            // referenced again (will be requeued on its next release)
+            pinfo.is_release_pending = false;
+        } else if (pinfo.handle.terminated()) {
+            // delete process (unreferenced and physically terminated)
             if (pinfo.terminated_event != NULL) {
-                delete pinfo.terminated_event;
+                this->_rc_free_event(pinfo.terminated_event);
             }
-            p_process_map.erase(it);
+            p_process_map.erase(pinfo.handle.get_process_object());
+        } else {
+            // still running (examine it again later)
+            p_release_list.push_back(&pinfo);
+        }
+    }
+}
+
+sc_event* rc_process_registry::_rc_alloc_event()
+{
+    if (p_free_events.empty()) {
+        sc_event* const slab = new sc_event[event_slab_size];
+        p_event_slabs.push_back(slab);
+        p_free_events.reserve(p_free_events.size() + event_slab_size);
+        for (int i = event_slab_size - 1; i >= 0; --i) {
+            p_free_events.push_back(&slab[i]);
         }
     }
+    sc_event* const e = p_free_events.back();
+    p_free_events.pop_back();
+    return e;
+}
+
+void rc_process_registry::_rc_free_event(sc_event* e)
+{
+    // (the event must not trigger its next user)
+    e->cancel();
+    p_free_events.push_back(e);
 }
 
 void rc_process_registry::_rc_create_singleton()
@@ -311,7 +318,8 @@ void rc_next_trigger(const sc_event& e)
 {
     rc_process_handle hproc = rc_get_current_process_handle();
     if (hproc.is_cancelable()) {
-        sc_core::next_trigger(e | hproc.get_cancel_trigger_event());
+        sc_core::next_trigger(e | hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event());
     } else {
         sc_core::next_trigger(e);
     }
@@ -321,7 +329,8 @@ void rc_next_trigger(sc_event_or_list& el)
 {
     rc_process_handle hproc = rc_get_current_process_handle();
     if (hproc.is_cancelable()) {
-        sc_core::next_trigger(el | hproc.get_cancel_trigger_event());
+        sc_core::next_trigger(el | hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event());
     } else {
         sc_core::next_trigger(el);
     }
@@ -339,7 +348,8 @@ void rc_next_trigger(sc_event_and_list& el)
                     &rc_process_registry::_rc_wait_event_and_list_proc,
                     sc_ref(el), continue_event.get()));
             sc_core::next_trigger(
-                *(continue_event.release()) | hproc.get_cancel_trigger_event());
+                *(continue_event.release()) | hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event());
             // (continue_event will be deleted by the spawned process)
         } else {
             sc_core::next_trigger(el);
@@ -353,7 +363,8 @@ void rc_next_trigger(const sc_time& t)
 {
     rc_process_handle hproc = rc_get_current_process_handle();
     if (hproc.is_cancelable()) {
-        sc_core::next_trigger(t, hproc.get_cancel_trigger_event());
+        sc_core::next_trigger(t, hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event());
     } else {
         sc_core::next_trigger(t);
     }
@@ -368,7 +379,8 @@ void rc_next_trigger(const sc_time& t, const sc_event& e)
 {
     rc_process_handle hproc = rc_get_current_process_handle();
     if (hproc.is_cancelable()) {
-        sc_core::next_trigger(t, e | hproc.get_cancel_trigger_event());
+        sc_core::next_trigger(t, e | hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event());
     } else {
         sc_core::next_trigger(t, e);
     }
@@ -383,7 +395,8 @@ void rc_next_trigger(const sc_time& t, sc_event_or_list& el)
 {
     rc_process_handle hproc = rc_get_current_process_handle();
     if (hproc.is_cancelable()) {
-        sc_core::next_trigger(t, el | hproc.get_cancel_trigger_event());
+        sc_core::next_trigger(t, el | hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event());
     } else {
         sc_core::next_trigger(t, el);
     }
@@ -407,7 +420,8 @@ void rc_next_trigger(const sc_time& t, sc_event_and_list& el)
                     sc_cref(t), sc_ref(el), continue_event.get()));
             sc_core::next_trigger(
                 t, (*(continue_event.release())
-                | hproc.get_cancel_trigger_event()));
+                | hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event()));
             // (continue_event will be deleted by the spawned process)
         } else {
             sc_core::next_trigger(t, el);
@@ -465,7 +479,8 @@ void rc_wait(const sc_event& e)
         if (hproc.is_canceled()) {
             throw new rc_process_cancel_exception();
         } else {
-            ::sc_core::wait(e | hproc.get_cancel_trigger_event());
+            ::sc_core::wait(e | hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event());
             if (hproc.is_canceled() || hproc.is_cancel_event()) {
                 throw new rc_process_cancel_exception();
             }
@@ -482,7 +497,8 @@ void rc_wait(sc_event_or_list& el)
         if (hproc.is_canceled()) {
             throw new rc_process_cancel_exception();
         } else {
-            ::sc_core::wait(el | hproc.get_cancel_trigger_event());
+            ::sc_core::wait(el | hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event());
             if (hproc.is_canceled() || hproc.is_cancel_event()) {
                 throw new rc_process_cancel_exception();
             }
@@ -508,7 +524,8 @@ void rc_wait(sc_event_and_list& el)
                     sc_ref(el), continue_event.get()),
                 NULL, &opt);
             ::sc_core::wait(
-                *(continue_event.release()) | hproc.get_cancel_trigger_event());
+                *(continue_event.release()) | hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event());
             // (continue_event will be deleted by the spawned process)
 
             if (hproc.is_canceled() || hproc.is_cancel_event()) {
@@ -527,7 +544,8 @@ void rc_wait(const sc_time& t)
         if (hproc.is_canceled()) {
             throw new rc_process_cancel_exception();
         } else {
-            ::sc_core::wait(t, hproc.get_cancel_trigger_event());
+            ::sc_core::wait(t, hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event());
             if (hproc.is_canceled() || hproc.is_cancel_event()) {
                 throw new rc_process_cancel_exception();
             }
@@ -549,7 +567,8 @@ void rc_wait(const sc_time& t, const sc_event& e)
         if (hproc.is_canceled()) {
             throw new rc_process_cancel_exception();
         } else {
-            ::sc_core::wait(t, e | hproc.get_cancel_trigger_event());
+            ::sc_core::wait(t, e | hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event());
             if (hproc.is_canceled() || hproc.is_cancel_event()) {
                 throw new rc_process_cancel_exception();
             }
@@ -571,7 +590,8 @@ void rc_wait(const sc_time& t, sc_event_or_list& el)
         if (hproc.is_canceled()) {
             throw new rc_process_cancel_exception();
         } else {
-            ::sc_core::wait(t, el | hproc.get_cancel_trigger_event());
+            ::sc_core::wait(t, el | hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event());
             if (hproc.is_canceled() || hproc.is_cancel_event()) {
                 throw new rc_process_cancel_exception();
             }
@@ -603,7 +623,8 @@ void rc_wait(const sc_time& t, sc_event_and_list& el)
                 NULL, &opt);
             ::sc_core::wait(
                 t, (*(continue_event.release())
-                | hproc.get_cancel_trigger_event()));
+                | hproc.get_cancel_trigger_event()
+                | hproc.get_shared_cancel_trigger_event()));
             // (continue_event will be deleted by the spawned process)
 
             if (hproc.is_canceled() || hproc.is_cancel_event()) {
@@ -40,6 +40,9 @@
 #include "ReChannel/core/rc_common_header.h"
 #include "ReChannel/util/rc_hash_map.h"
 
+#include <deque>
+#include <boost/pool/pool_alloc.hpp>
+
 namespace ReChannel {
 
 // you may decrease stack size to 1KB (or even lower) if your OS allows
@@ -47,6 +50,16 @@ namespace ReChannel {
  #define RC_PROCESS_TEMP_PROC_STACK_SIZE 16384
 #endif // RC_PROCESS_TEMP_PROC_STACK_SIZE
 
+// number of release candidates examined per process registration
+#ifndef RC_PROCESS_RECLAIM_BATCH_SIZE
+ #define RC_PROCESS_RECLAIM_BATCH_SIZE 8
+#endif // RC_PROCESS_RECLAIM_BATCH_SIZE
+
+// number of terminated events allocated at once
+#ifndef RC_PROCESS_EVENT_SLAB_SIZE
+ #define RC_PROCESS_EVENT_SLAB_SIZE 64
+#endif // RC_PROCESS_EVENT_SLAB_SIZE
+
 class rc_process_handle;
 class rc_process_behavior_change;
 class rc_process_cancel_exception;
@@ -61,6 +74,14 @@ class process_support;
 
 /**
  * @brief Controls the cancellation of resettable processes.
+ *
+ * A process control may depend on a parent process control. The
+ * deactivation of the parent cancels all of its dependents in constant
+ * time: the parent advances its epoch and notifies its deactivation
+ * event, which is shared by the dependents (see
+ * get_shared_deactivation_event()). A dependent detects the
+ * cancellation by comparing the parent's epoch with the epoch it has
+ * been activated in.
  */
 class rc_process_control
 {
@@ -82,15 +103,19 @@ public:
 
     void deactivate();
 
-    inline bool is_active() const
-        { return !p_cancel_flag; }
+    inline bool is_active() const;
 
-    inline bool is_deactivation_event() const
-        { return (p_cancel_delta == sc_delta_count()); }
+    inline bool is_deactivation_event() const;
 
     inline const sc_event& get_deactivation_event() const
         { return p_cancel_event; }
 
+    // returns the deactivation event of the parent (or NULL)
+    inline const sc_event* get_shared_deactivation_event() const;
+
+    inline sc_dt::uint64 get_epoch() const
+        { return p_epoch; }
+
     inline bool is_activation_event() const
         { return (p_activation_delta == sc_delta_count()); }
 
@@ -121,6 +146,9 @@ private:
 
     bool          p_deactivate_silently;
 
+    sc_dt::uint64 p_epoch;
+    sc_dt::uint64 p_parent_epoch;
+
     const rc_process_control* p_parent;
     mutable pctrl_set         p_child_set;
 
@@ -140,9 +168,9 @@ struct rc_process_info
     bool                 is_cancelable   : 1;
     bool                 is_terminated   : 1;
     bool                 is_temporary    : 1;
-    const sc_event*      cancel_event;
-    const bool*          cancel_flag;
-    const sc_dt::uint64* cancel_delta;
+    // (entry is queued in the registry's release list)
+    bool                 is_release_pending : 1;
+    const rc_process_control* process_control;
     sc_event*            terminated_event;
 };
 
@@ -212,10 +240,6 @@ public:
     inline rc_process_behavior_change behavior_change(
         const rc_process_control& pctrl);
 
-    /*inline rc_process_behavior_change behavior_change(
-        bool is_cancelable, const sc_event* cancel_event,
-        const bool* cancel_flag, const sc_dt::uint64* cancel_delta);*/
-
 /* members for sc_process_handle compatibility */
 
     inline bool valid() const;
@@ -234,6 +258,8 @@ private:
 
     inline const sc_event& get_cancel_trigger_event() const;
 
+    inline const sc_event& get_shared_cancel_trigger_event() const;
+
 /* special members called by class process_support */
 
     // note: calling these methods requires a handle on the current process
@@ -282,22 +308,37 @@ class rc_process_registry
     friend void rc_wait(double, sc_time_unit, sc_event_and_list&);
 
     friend class rc_process_handle;
+    friend class rc_process_behavior_change;
     friend class tmp_behavior_modification;
     friend class tmp_behavior_modification_simple;
     friend class internals::process_support;
 
 private:
-    enum registry_options { gc_interval=100 };
+    enum registry_options {
+        reclaim_batch_size = RC_PROCESS_RECLAIM_BATCH_SIZE,
+        event_slab_size = RC_PROCESS_EVENT_SLAB_SIZE
+    };
 
 protected:
-    typedef rc_hash_map<sc_object*, rc_process_info> process_map;
+    // (the entries are allocated from a pool)
+    typedef rc_hash_map<
+            sc_object*, rc_process_info,
+            boost::hash<sc_object*>, std::equal_to<sc_object*>,
+            boost::fast_pool_allocator<
+                internals::hash_map::pair<sc_object*, rc_process_info>,
+                boost::default_user_allocator_new_delete,
+                boost::details::pool::null_mutex> >
+        process_map;
+    typedef std::deque<rc_process_info*> process_info_deque;
+    typedef std::vector<sc_event*>       event_vector;
 
 public:
     // returns the number of the current entries in the registry
     inline unsigned int get_process_count() const
         { return p_process_map.size(); }
 
-    // deletes physically terminated processes from the registry
+    // deletes the unreferenced, physically terminated processes
+    // from the registry
     void gc();
 
 protected:
@@ -318,11 +359,15 @@ private:
         bool is_cancelable, const rc_process_control& pctrl,
         bool is_temporary=false);
 
-    rc_process_handle register_process(
-        const sc_process_handle& hproc, bool dont_initialize,
-        bool is_cancelable, const sc_event* cancel_event,
-        const bool* cancel_flag, const sc_dt::uint64* cancel_delta,
-        bool is_temporary=false);
+    // called if the reference count of an entry has dropped to zero
+    inline void _rc_release(rc_process_info& pinfo);
+
+    // examines at most max_count entries of the release list
+    void _rc_reclaim(unsigned int max_count);
+
+    sc_event* _rc_alloc_event();
+
+    void _rc_free_event(sc_event* e);
 
 private:
     static void _rc_wait_event_and_list_proc(
@@ -339,6 +384,11 @@ private:
 
     rc_process_handle p_cached_hproc;
 
+    process_info_deque p_release_list;
+
+    event_vector p_free_events;
+    event_vector p_event_slabs;
+
 private:
     static rc_process_registry* s_instance;
 
@@ -357,6 +407,14 @@ rc_process_registry& rc_get_process_registry()
     return *(rc_process_registry::s_instance);
 }
 
+inline void rc_process_registry::_rc_release(rc_process_info& pinfo)
+{
+    if (!pinfo.is_release_pending) {
+        pinfo.is_release_pending = true;
+        p_release_list.push_back(&pinfo);
+    }
+}
+
 class rc_process_behavior_change
 {
     friend class rc_process_handle;
@@ -383,21 +441,14 @@ private:
         rc_process_info& proc_info, bool is_cancelable,
         const rc_process_control& pctrl);
 
-    inline rc_process_behavior_change(
-        rc_process_info& proc_info, bool is_cancelable,
-        const sc_event* cancel_event, const bool* cancel_flag,
-        const sc_dt::uint64* cancel_delta);
-
     inline rc_process_behavior_change& operator=(
         const rc_process_behavior_change& pbc);
 
 private:
     mutable rc_process_info* p_proc_info;
-    bool                     p_orig_is_cancelable;
-    const sc_event*          p_orig_cancel_event;
-    const bool*              p_orig_cancel_flag;
-    const sc_dt::uint64*     p_orig_cancel_delta;
-    sc_event*                p_orig_terminated_event;
+    bool                      p_orig_is_cancelable;
+    const rc_process_control* p_orig_process_control;
+    sc_event*                 p_orig_terminated_event;
 };
 
 /**
@@ -487,6 +538,26 @@ private:
 
 /* inline code */
 
+inline bool rc_process_control::is_active() const
+{
+    return (!p_cancel_flag
+        && (p_parent == NULL
+            || (p_parent_epoch == p_parent->p_epoch
+                && p_parent->is_active())));
+}
+
+inline bool rc_process_control::is_deactivation_event() const
+{
+    return (p_cancel_delta == sc_delta_count()
+        || (p_parent != NULL && p_parent->is_deactivation_event()));
+}
+
+inline
+const sc_event* rc_process_control::get_shared_deactivation_event() const
+{
+    return (p_parent != NULL ? &p_parent->p_cancel_event : NULL);
+}
+
 inline rc_process_handle::rc_process_handle()
     : p_proc_info(NULL)
 { }
@@ -522,7 +593,9 @@ inline rc_process_handle::rc_process_handle(const sc_process_handle& hproc)
 
 inline rc_process_handle::~rc_process_handle()
 {
-    if (p_proc_info != NULL) { --p_proc_info->ref_count; }
+    if (p_proc_info != NULL && --p_proc_info->ref_count == 0) {
+        rc_get_process_registry()._rc_release(*p_proc_info);
+    }
 }
 
 inline
@@ -530,9 +603,12 @@ rc_process_handle&
 rc_process_handle::operator=(const rc_process_handle& hproc)
 {
     if (&hproc != this) {
-        if (p_proc_info != NULL) { --p_proc_info->ref_count; }
+        rc_process_info* const old_proc_info = p_proc_info;
         p_proc_info = hproc.p_proc_info;
         if (p_proc_info != NULL) { ++p_proc_info->ref_count; }
+        if (old_proc_info != NULL && --old_proc_info->ref_count == 0) {
+            rc_get_process_registry()._rc_release(*old_proc_info);
+        }
     }
     return *this;
 }
@@ -578,9 +654,9 @@ inline bool rc_process_handle::is_canceled() const
             return true;
         } else if (p_proc_info->handle.valid()
         && p_proc_info->is_cancelable
-        && p_proc_info->cancel_flag != NULL)
+        && p_proc_info->process_control != NULL)
         {
-            return *(p_proc_info->cancel_flag);
+            return !p_proc_info->process_control->is_active();
         }
     }
     return false;
@@ -590,58 +666,58 @@ inline bool rc_process_handle::is_cancel_event() const
 {
     return (p_proc_info != NULL && p_proc_info->handle.valid()
         && p_proc_info->is_cancelable
-        && *(p_proc_info->cancel_delta) == sc_delta_count());
+        && p_proc_info->process_control != NULL
+        && p_proc_info->process_control->is_deactivation_event());
 }
 
 inline const sc_event& rc_process_handle::get_cancel_trigger_event() const
 {
     if (p_proc_info != NULL && p_proc_info->handle.valid()
-    && p_proc_info->cancel_event != NULL)
+    && p_proc_info->process_control != NULL)
     {
-        return *p_proc_info->cancel_event;
+        return p_proc_info->process_control->get_deactivation_event();
     } else {
         return s_never_notified;
     }
 }
 
 inline
-rc_process_behavior_change
-rc_process_handle::behavior_change(bool is_cancelable)
+const sc_event& rc_process_handle::get_shared_cancel_trigger_event() const
 {
-    if (p_proc_info != NULL && p_proc_info->handle.valid()) {
-        return rc_process_behavior_change(
-            *p_proc_info, is_cancelable);
+    if (p_proc_info != NULL && p_proc_info->handle.valid()
+    && p_proc_info->process_control != NULL
+    && p_proc_info->process_control->has_parent())
+    {
+        return *p_proc_info->process_control
+            ->get_shared_deactivation_event();
     } else {
-        return rc_process_behavior_change();
+        return s_never_notified;
     }
 }
 
 inline
 rc_process_behavior_change
-rc_process_handle::behavior_change(const rc_process_control& pctrl)
+rc_process_handle::behavior_change(bool is_cancelable)
 {
     if (p_proc_info != NULL && p_proc_info->handle.valid()) {
         return rc_process_behavior_change(
-            *p_proc_info, true, pctrl);
+            *p_proc_info, is_cancelable);
     } else {
         return rc_process_behavior_change();
     }
 }
 
-/*inline
+inline
 rc_process_behavior_change
-rc_process_handle::behavior_change(
-    bool is_cancelable, const sc_event* cancel_event,
-    const bool* cancel_flag, const sc_dt::uint64* cancel_delta)
+rc_process_handle::behavior_change(const rc_process_control& pctrl)
 {
     if (p_proc_info != NULL && p_proc_info->handle.valid()) {
         return rc_process_behavior_change(
-            *p_proc_info, is_cancelable, cancel_event, cancel_flag,
-            cancel_delta);
+            *p_proc_info, true, pctrl);
     } else {
         return rc_process_behavior_change();
     }
-}*/
+}
 
 inline
 bool rc_process_handle::is_terminatable() const
@@ -749,8 +825,7 @@ inline void rc_process_handle::notify_terminated_event()
 inline
 rc_process_behavior_change::rc_process_behavior_change()
     : p_proc_info(NULL),
-      p_orig_is_cancelable(false), p_orig_cancel_event(NULL),
-      p_orig_cancel_flag(NULL), p_orig_cancel_delta(NULL),
+      p_orig_is_cancelable(false), p_orig_process_control(NULL),
       p_orig_terminated_event(NULL)
 { }
 
@@ -759,9 +834,7 @@ rc_process_behavior_change::rc_process_behavior_change(
     rc_process_info& proc_info, bool is_cancelable)
     : p_proc_info(&proc_info),
       p_orig_is_cancelable(proc_info.is_cancelable),
-      p_orig_cancel_event(proc_info.cancel_event),
-      p_orig_cancel_flag(proc_info.cancel_flag),
-      p_orig_cancel_delta(proc_info.cancel_delta),
+      p_orig_process_control(proc_info.process_control),
       p_orig_terminated_event(proc_info.terminated_event)
 {
     ++proc_info.ref_count;
@@ -777,38 +850,12 @@ rc_process_behavior_change::rc_process_behavior_change(
     const rc_process_control& pctrl)
     : p_proc_info(&proc_info),
       p_orig_is_cancelable(proc_info.is_cancelable),
-      p_orig_cancel_event(proc_info.cancel_event),
-      p_orig_cancel_flag(proc_info.cancel_flag),
-      p_orig_cancel_delta(proc_info.cancel_delta),
+      p_orig_process_control(proc_info.process_control),
       p_orig_terminated_event(proc_info.terminated_event)
 {
     ++proc_info.ref_count;
     proc_info.is_cancelable = is_cancelable;
-    proc_info.cancel_event = &pctrl.p_cancel_event;
-    proc_info.cancel_flag = &pctrl.p_cancel_flag;
-    proc_info.cancel_delta = &pctrl.p_cancel_delta;
-    if (is_cancelable == false) {
-        proc_info.terminated_event = NULL;
-    }
-}
-
-inline
-rc_process_behavior_change::rc_process_behavior_change(
-    rc_process_info& proc_info, bool is_cancelable,
-    const sc_event* cancel_event, const bool* cancel_flag,
-    const sc_dt::uint64* cancel_delta)
-    : p_proc_info(&proc_info),
-      p_orig_is_cancelable(proc_info.is_cancelable),
-      p_orig_cancel_event(proc_info.cancel_event),
-      p_orig_cancel_flag(proc_info.cancel_flag),
-      p_orig_cancel_delta(proc_info.cancel_delta),
-      p_orig_terminated_event(proc_info.terminated_event)
-{
-    ++proc_info.ref_count;
-    proc_info.is_cancelable = is_cancelable;
-    proc_info.cancel_event = cancel_event;
-    proc_info.cancel_flag = cancel_flag;
-    proc_info.cancel_delta = cancel_delta;
+    proc_info.process_control = &pctrl;
     if (is_cancelable == false) {
         proc_info.terminated_event = NULL;
     }
@@ -820,9 +867,7 @@ rc_process_behavior_change::rc_process_behavior_change(
 {
     p_proc_info = pbc.p_proc_info;
     p_orig_is_cancelable = pbc.p_orig_is_cancelable;
-    p_orig_cancel_event = pbc.p_orig_cancel_event;
-    p_orig_cancel_flag = pbc.p_orig_cancel_flag;
-    p_orig_cancel_delta = pbc.p_orig_cancel_delta;
+    p_orig_process_control = pbc.p_orig_process_control;
     p_orig_terminated_event = pbc.p_orig_terminated_event;
     pbc.p_proc_info = NULL;
 }
@@ -831,11 +876,11 @@ inline void rc_process_behavior_change::release()
 {
     if (p_proc_info != NULL) {
         p_proc_info->is_cancelable = p_orig_is_cancelable;
-        p_proc_info->cancel_event = p_orig_cancel_event;
-        p_proc_info->cancel_flag = p_orig_cancel_flag;
-        p_proc_info->cancel_delta = p_orig_cancel_delta;
+        p_proc_info->process_control = p_orig_process_control;
         p_proc_info->terminated_event = p_orig_terminated_event;
-        --p_proc_info->ref_count;
+        if (--p_proc_info->ref_count == 0) {
+            rc_get_process_registry()._rc_release(*p_proc_info);
+        }
         p_proc_info = NULL;
     }
 }
@@ -848,9 +893,7 @@ rc_process_behavior_change& rc_process_behavior_change::operator=(
         this->release();
         p_proc_info = pbc.p_proc_info;
         p_orig_is_cancelable = pbc.p_orig_is_cancelable;
-        p_orig_cancel_event = pbc.p_orig_cancel_event;
-        p_orig_cancel_flag = pbc.p_orig_cancel_flag;
-        p_orig_cancel_delta = pbc.p_orig_cancel_delta;
+        p_orig_process_control = pbc.p_orig_process_control;
         p_orig_terminated_event = pbc.p_orig_terminated_event;
         pbc.p_proc_info = NULL;
     }
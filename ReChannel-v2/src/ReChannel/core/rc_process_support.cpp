@@ -39,56 +39,36 @@
 namespace ReChannel {
 namespace internals {
 
-process_support::process_info::reset_signal_map
-    process_support::process_info::p_reset_signal_map;
+process_support::process_info::reset_monitor_map
+    process_support::process_info::p_reset_monitor_map;
 
 const rc_reset_channel_if&
-
 process_support::process_info::_rc_get_reset_channel(
     const sc_signal_in_if<bool>& signal_interface)
 {
     const rc_reset_channel_if* reset_channel =
         dynamic_cast<const rc_reset_channel_if*>(&signal_interface);
     if (reset_channel == NULL) {
-        reset_signal*& signal_ = p_reset_signal_map[&signal_interface];
-        if (signal_ == NULL) {
-            signal_ = new reset_signal(
-                sc_gen_unique_name("_rc_process_support_reset_signal"));
-            // (reset_signal will be deleted by SystemC)
-
-            sc_spawn_options opt;
-            {
-                opt.spawn_method();
-                opt.set_sensitivity(
-                    &signal_interface.value_changed_event());
-            }
-            sc_spawn(
-                sc_bind(
-                    &process_info::_rc_reset_updater_proc,
-                    sc_cref(signal_interface), sc_ref(*signal_)),
-                sc_gen_unique_name(
-                    "_rc_process_support_reset_updater_proc"),
-                &opt);
+        // the process controls are deactivated by a shared monitor
+        reset_monitor*& monitor = p_reset_monitor_map[&signal_interface];
+        if (monitor == NULL) {
+            monitor = new reset_monitor(signal_interface);
         }
-        reset_channel = static_cast<const rc_reset_channel_if*>(signal_);
+        reset_channel = static_cast<const rc_reset_channel_if*>(monitor);
     }
     return *reset_channel;
 }
 
-void process_support::process_info::_rc_reset_updater_proc(
-    const sc_signal_in_if<bool>& from_, reset_signal& to_)
-{
-    to_.write(from_.read());
-}
-
 process_support::process_info::process_info(
     boost::function<void (void)> func_,
     const rc_process_control& parent_pctrl, bool is_thread_,
     bool is_dont_initialize, bool has_sync_reset)
     : func(func_), process_control(
           parent_pctrl, parent_pctrl.is_active(), has_sync_reset),
+      resume_point(0),
       p_is_thread(is_thread_), p_is_dont_initialize(false),
-      p_is_init_run(false)
+      p_is_init_run(false), p_is_poolable(false),
+      p_is_stackless(false), p_is_started(false), p_is_clocked(false)
 { }
 
 process_support::process_info::~process_info()
@@ -181,7 +161,9 @@ process_support::process_support()
       p_reconf(
           process_support::_rc_find_context(this->get_parent_object())),
       p_last_pinfo(NULL), p_last_host(NULL),
-      p_last_host_child_count(0)
+      p_last_host_child_count(0), p_stack_size(RC_PROCESS_STACK_SIZE),
+      p_curr_stackless(NULL), p_curr_clocked(NULL),
+      p_curr_clocked_proc(NULL)
 {
     // check if process support is used within a resettable module
     sc_object* parent = this->get_parent_object();
@@ -199,74 +181,138 @@ process_support::process_support()
 }
 
 void process_support::declare_process(
-    const sc_object& host,
-    const boost::function<void (void)>& declare_proc_callback,
+    const sc_object& host, const char* name,
     const boost::function<void (void)>& func, sc_sensitive& sensitive,
-    bool is_thread, bool dont_initialize, bool has_sync_reset)
+    sc_sensitive_pos& sensitive_pos, sc_sensitive_neg& sensitive_neg,
+    bool is_thread, bool dont_initialize, bool has_sync_reset,
+    int stack_size, bool is_stackless)
 {
-    // store the current process object before the creation
-    sc_object* const proc_obj_before =
-        sc_get_current_process_handle().get_process_object();
+    const rc_process_control& reconf_pctrl =
+        p_reconf.rc_get_process_control();
+
+    process_info* const pinfo =
+        new process_info(
+            func, reconf_pctrl, is_thread, dont_initialize,
+            has_sync_reset);
+
+    // the process info is bound to the body to avoid lookups on execution
+    boost::function<void (void)> entry_func;
+    sc_spawn_options opt;
+    if (is_thread) {
+        entry_func =
+            boost::bind(&process_support::thread_process, this, pinfo);
+        // (the per-process hint overrides the module's stack size)
+        if (stack_size == 0) {
+            stack_size = p_stack_size;
+        }
+        if (stack_size > 0) {
+            opt.set_stack_size(stack_size);
+        }
+    } else if (is_stackless) {
+        pinfo->set_stackless(true);
+        entry_func =
+            boost::bind(&process_support::stackless_process, this, pinfo);
+        opt.spawn_method();
+    } else {
+        entry_func =
+            boost::bind(&process_support::method_process, this, pinfo);
+        opt.spawn_method();
+    }
 
     // suppress 'object name already exists' warning
     const sc_actions actions =
         sc_report_handler::set_actions(
             SC_WARNING, SC_DO_NOTHING);
 
-    // invoke the callback to let it create the process
-    declare_proc_callback();
+    // create the process (the host module is the current parent)
+    const sc_process_handle proc = sc_spawn(entry_func, name, &opt);
 
     // reset report action
     sc_report_handler::set_actions(SC_WARNING, actions);
 
-    sc_object* const proc_obj =
-        sc_get_current_process_handle().get_process_object();
+    sc_object* const proc_obj = proc.get_process_object();
 
-    // check if process was created correctly by declare_proc_callback()
-    if (proc_obj == NULL || proc_obj == proc_obj_before) {
-        // declare_proc_callback() didn't do what was expected from it
+    // check if the process was created correctly
+    if (proc_obj == NULL) {
+        delete pinfo;
         RC_REPORT_ERROR(RC_ID_INVALID_USAGE_,
             "invalid usage (in '" << this->name() << "')");
     }
 
-    const rc_process_control& reconf_pctrl =
-        p_reconf.rc_get_process_control();
+    pinfo->hproc = rc_get_process_registry().register_process(
+        proc, pinfo->is_dont_initialize(), true, pinfo->process_control);
 
-    process_info* const pinfo =
-        new process_info(
-            func, reconf_pctrl, is_thread, dont_initialize,
-            has_sync_reset);
     p_reconf_pinfo_map[proc_obj] = pinfo;
     p_last_pinfo = pinfo;
     p_last_host = &host;
     p_last_host_child_count = host.get_child_objects().size();
 
+    // subsequent sensitivity declarations will refer to this process
+    sensitive << proc;
+    sensitive_pos << proc;
+    sensitive_neg << proc;
     sensitive << (pinfo->process_control.get_deactivation_event());
+    // (the deactivation of the reconfigurable is notified by a shared event)
+    sensitive << (*pinfo->process_control.get_shared_deactivation_event());
 }
 
-void process_support::method_process()
+void process_support::declare_clocked_process(
+    const sc_object& host, const char* name,
+    const boost::function<void (void)>& func, sc_sensitive& sensitive,
+    sc_sensitive_pos& sensitive_pos, sc_sensitive_neg& sensitive_neg,
+    int stack_size)
 {
-    const sc_process_handle curr_proc = sc_get_current_process_handle();
-    process_info* const pinfo =
-        this->_rc_find_process_info(curr_proc.get_process_object());
+    // a clocked thread is an RC_CTHREAD with a fast wait()
+    this->declare_process(
+        host, name, func, sensitive, sensitive_pos, sensitive_neg,
+        true, true, true, stack_size);
+
+    // the process info is bound to the body to avoid lookups on wait()
+    p_last_pinfo->set_clocked(true);
+    p_last_pinfo->func =
+        boost::bind(
+            &process_support::clocked_process, this, p_last_pinfo, func);
+}
 
-    if (pinfo == NULL || curr_proc.proc_kind() != SC_METHOD_PROC_ )
-    {
-        RC_REPORT_ERROR(RC_ID_INVALID_USAGE_,
-            "invalid usage (in '" << this->name() << "')");
+void process_support::clocked_wait(int n)
+{
+    process_info* const pinfo = this->_rc_get_curr_clocked();
+    if (pinfo == NULL) {
+        // (not called by a clocked thread or its binding is displaced)
+        if (n == 1) {
+            rc_wait();
+        } else {
+            rc_wait(n);
+        }
+        return;
+    }
+    // (the process control may be changed by a behavior change)
+    const rc_process_info& proc_info = *pinfo->hproc.p_proc_info;
+    if (!proc_info.is_cancelable || proc_info.process_control == NULL) {
+        ::sc_core::wait(n);
+        return;
+    }
+    const rc_process_control& pctrl = *proc_info.process_control;
+    if (!pctrl.is_active() || proc_info.is_terminated) {
+        throw new rc_process_cancel_exception();
+    }
+    sc_process_b* const proc = p_curr_clocked_proc;
+    for (int i=0; i < n; i++) {
+        // (the static sensitivity contains the deactivation events)
+        ::sc_core::wait();
+        p_curr_clocked = pinfo;
+        p_curr_clocked_proc = proc;
+        if (!pctrl.is_active() || pctrl.is_deactivation_event()) {
+            throw new rc_process_cancel_exception();
+        }
     }
+}
 
+void process_support::method_process(process_info* pinfo)
+{
     const rc_process_control& reconf_pctrl =
         p_reconf.rc_get_process_control();
 
-    rc_process_registry& preg = rc_get_process_registry();
-    rc_process_handle hproc = preg.get_process_handle(curr_proc, false);
-    if (!hproc.valid()) {
-        hproc = preg.register_process(
-            curr_proc, pinfo->is_dont_initialize(), true,
-            pinfo->process_control);
-    }
-
     if (reconf_pctrl.is_active()) {
         if (pinfo->is_init_run() && pinfo->is_dont_initialize()) {
             pinfo->set_init_run(false);
@@ -290,25 +336,100 @@ void process_support::method_process()
     ::sc_core::next_trigger(reconf_pctrl.get_activation_event());
 }
 
-void process_support::thread_process()
+void process_support::stackless_process(process_info* pinfo)
+{
+    const rc_process_control& reconf_pctrl =
+        p_reconf.rc_get_process_control();
+    rc_process_info& proc_info = *pinfo->hproc.p_proc_info;
+
+    if (reconf_pctrl.is_active()) {
+        if (!pinfo->is_started()) {
+            pinfo->set_started(true);
+            pinfo->update_process_control_state();
+        }
+        // (a terminated stackless thread is only triggered on activation)
+        proc_info.is_terminated = false;
+        if (pinfo->is_init_run() && pinfo->is_dont_initialize()) {
+            pinfo->set_init_run(false);
+            // wait for next trigger
+            return;
+        }
+        if (!pinfo->process_control.is_active()) {
+            // just this process has been reset
+            pinfo->resume_point = 0;
+            if (pinfo->has_sync_reset()) {
+                pinfo->update_process_control_state();
+                if (!pinfo->process_control.is_active()) {
+                    // wait for next trigger
+                    return;
+                }
+            } else {
+                pinfo->process_control.activate();
+            }
+        }
+        p_curr_stackless = pinfo;
+        try {
+            // resume the state machine
+            pinfo->func();
+        } catch(rc_process_cancel_exception* e) {
+            delete e; // consume exception
+            pinfo->resume_point = 0;
+        }
+        p_curr_stackless = NULL;
+
+        // has the state machine just been suspended?
+        if (pinfo->resume_point != process_info::resume_exited
+        && !proc_info.is_terminated) {
+            return;
+        }
+    }
+
+    // the process has terminated or the reconf. has been deactivated
+    if (!proc_info.is_terminated && proc_info.terminated_event != NULL) {
+        proc_info.is_terminated = true;
+        proc_info.terminated_event->notify();
+    }
+    pinfo->resume_point = 0;
+    if (pinfo->is_dont_initialize()) {
+        pinfo->set_init_run(true);
+    }
+
+    // wait for next activation
+    ::sc_core::next_trigger(reconf_pctrl.get_activation_event());
+}
+
+void process_support::clocked_process(
+    process_info* pinfo, const boost::function<void (void)>& func)
+{
+    p_curr_clocked = pinfo;
+    p_curr_clocked_proc = sc_get_current_process_b();
+    // call the user function
+    func();
+}
+
+void process_support::thread_process(process_info* pinfo_)
 {
-    const sc_process_handle curr_proc = sc_get_current_process_handle();
+    // the thread takes the ownership of its process info
     const std::auto_ptr<process_info> pinfo(
-        this->_rc_fetch_process_info(curr_proc.get_process_object()));
+        this->_rc_fetch_process_info(pinfo_->hproc.get_process_object()));
 
-    if (pinfo.get() == NULL || curr_proc.proc_kind() != SC_THREAD_PROC_ )
-    {
+    if (pinfo.get() != pinfo_) {
         RC_REPORT_ERROR(RC_ID_INVALID_USAGE_,
             "invalid usage (in '" << this->name() << "')");
     }
 
-    rc_process_registry& preg = rc_get_process_registry();
-    rc_process_handle hproc = preg.get_process_handle(curr_proc, false);
-    if (!hproc.valid()) {
-        hproc = preg.register_process(
-            curr_proc, pinfo->is_dont_initialize(), true,
-            pinfo->process_control);
-    }
+    do {
+        // run the thread
+        this->_rc_run_thread(*pinfo);
+        // (only a terminated temporary thread will get here)
+    } while (this->_rc_park_worker(*pinfo));
+    // terminate physically...
+}
+
+void process_support::_rc_run_thread(process_info& pinfo_)
+{
+    process_info* const pinfo = &pinfo_;
+    rc_process_handle hproc = pinfo->hproc;
 
     const rc_process_control& reconf_pctrl =
         p_reconf.rc_get_process_control();
@@ -344,6 +465,8 @@ void process_support::thread_process()
         {
             // is process temporary?
             if (hproc.is_temporary()) {
+                // (the thread may outlive the process as an idle worker)
+                hproc.p_proc_info->is_terminated = true;
                 // notify termination event
                 hproc.notify_terminated_event();
                 // terminate process
@@ -370,7 +493,60 @@ void process_support::thread_process()
         // restart process...
         continue;
     }
-    // terminate physically...
+}
+
+bool process_support::_rc_park_worker(process_info& pinfo)
+{
+    if (!pinfo.is_poolable()
+    || p_idle_workers.size() >= RC_PROCESS_POOL_SIZE)
+    {
+        return false;
+    }
+    // release the handle (the worker is reusable if it is unreferenced)
+    pinfo.hproc = rc_process_handle();
+    p_idle_workers.push_back(&pinfo);
+
+    // wait for the next function to run (see rc_spawn())
+    ::sc_core::wait(pinfo.worker_event);
+    return true;
+}
+
+process_support::process_info* process_support::_rc_fetch_idle_worker()
+{
+    rc_process_registry& preg = rc_get_process_registry();
+    for (int i = (int)p_idle_workers.size() - 1; i >= 0; --i) {
+        process_info* const worker = p_idle_workers[i];
+        bool is_unreferenced;
+        {
+            const rc_process_handle hproc =
+                preg.get_process_handle(worker->worker_proc, false);
+            // (the only reference is the local one)
+            is_unreferenced = (hproc.p_proc_info != NULL
+                && hproc.p_proc_info->ref_count == 1);
+        }
+        if (is_unreferenced) {
+            p_idle_workers.erase(p_idle_workers.begin() + i);
+            return worker;
+        }
+    }
+    return NULL;
+}
+
+int& process_support::get_resume_point() const
+{
+    if (p_curr_stackless == NULL) {
+        RC_REPORT_ERROR(RC_ID_INVALID_USAGE_,
+            "stackless thread body used by a non-stackless process"
+            " (in '" << this->name() << "')");
+    }
+    return p_curr_stackless->resume_point;
+}
+
+void process_support::stackless_exit() const
+{
+    if (p_curr_stackless != NULL) {
+        p_curr_stackless->resume_point = process_info::resume_exited;
+    }
 }
 
 void process_support::dont_initialize(
@@ -379,6 +555,7 @@ void process_support::dont_initialize(
     if (this->has_reconfigurable_context()) {
         if (!sc_is_running() && this->_rc_check_valid_last_proc(host)) {
             p_last_pinfo->set_dont_initialize(true);
+            p_last_pinfo->hproc.p_proc_info->dont_initialize = true;
         }
     }
 }
@@ -392,28 +569,39 @@ rc_process_handle process_support::rc_spawn(
         RC_REPORT_ERROR(RC_ID_INVALID_USAGE_,
             "invalid usage (in '" << this->name() << "')");
     }
+    const rc_process_control& reconf_pctrl =
+        p_reconf.rc_get_process_control();
+
+    // can an idle worker be reused?
+    const bool is_poolable =
+        (sc_is_running() && name_p == NULL && opt_p == NULL);
+    if (is_poolable && !p_idle_workers.empty()) {
+        process_info* const worker = this->_rc_fetch_idle_worker();
+        if (worker != NULL) {
+            worker->func = func;
+            worker->process_control.activate();
+            worker->hproc = rc_get_process_registry().register_process(
+                worker->worker_proc, false, true, worker->process_control,
+                true);
+            // resume the worker (in the current delta cycle)
+            worker->worker_event.notify();
+            return worker->hproc;
+        }
+    }
+
     sc_spawn_options  opt_tmp;
     sc_spawn_options* spawn_options;
     if (opt_p != NULL) {
         spawn_options = static_cast<sc_spawn_options*>(opt_p);
     } else {
         spawn_options = &opt_tmp;
+        if (p_stack_size > 0) {
+            opt_tmp.set_stack_size(p_stack_size);
+        }
     }
 
     rc_process_registry& preg = rc_get_process_registry();
 
-    // create the entry point of the reconfigurable process
-    boost::function<void (void)> entry_func;
-    if (spawn_options->is_method()) {
-        entry_func =
-            boost::bind(&process_support::method_process, this);
-    } else {
-        entry_func =
-            boost::bind(&process_support::thread_process, this);
-    }
-
-    const rc_process_control& reconf_pctrl =
-        p_reconf.rc_get_process_control();
     bool is_thread = !spawn_options->is_method();
     bool dont_initialize = (opt_p != NULL && opt_p->is_dont_initialize());
     std::auto_ptr<process_info> pinfo(
@@ -449,8 +637,20 @@ rc_process_handle process_support::rc_spawn(
         }
     }
 
+    // create the entry point of the reconfigurable process
+    // (the process info is bound to avoid lookups on execution)
+    boost::function<void (void)> entry_func;
+    if (spawn_options->is_method()) {
+        entry_func =
+            boost::bind(&process_support::method_process, this, pinfo.get());
+    } else {
+        entry_func =
+            boost::bind(&process_support::thread_process, this, pinfo.get());
+    }
+
     const rc_process_control& pctrl = pinfo->process_control;
     spawn_options->set_sensitivity(&pctrl.get_deactivation_event());
+    spawn_options->set_sensitivity(pctrl.get_shared_deactivation_event());
 
     // suppress 'object name already exists' warning
     const sc_actions actions =
@@ -464,12 +664,17 @@ rc_process_handle process_support::rc_spawn(
     // reset report action
     sc_report_handler::set_actions(SC_WARNING, actions);
 
+    const bool is_temporary = sc_is_running();
+    pinfo->hproc = preg.register_process(
+        spawned_process, dont_initialize, true, pctrl, is_temporary);
+    pinfo->worker_proc = spawned_process;
+    pinfo->set_poolable(is_poolable && is_thread);
+    const rc_process_handle hproc = pinfo->hproc;
+
     sc_object* const proc_obj = spawned_process.get_process_object();
     p_reconf_pinfo_map[proc_obj] = pinfo.release();
 
-    const bool is_temporary = sc_is_running();
-    return preg.register_process(
-        spawned_process, dont_initialize, true, pctrl, is_temporary);
+    return hproc;
 }
 
 void process_support::terminate()
@@ -550,7 +755,7 @@ void process_support::reset_is(
 void process_support::set_sync_reset(const sc_object& host, bool b) const
 {
     if (!sc_is_running() && this->_rc_check_valid_last_proc(host)) {
-        if (p_last_pinfo->is_thread()) {
+        if (p_last_pinfo->is_thread() || p_last_pinfo->is_stackless()) {
             p_last_pinfo->set_sync_reset(b);
         } else {
             RC_REPORT_WARNING(RC_ID_INVALID_USAGE_,
@@ -588,14 +793,6 @@ void process_support::before_end_of_elaboration()
     }
 }
 
-process_support::process_info* process_support::_rc_find_process_info(
-    sc_object* proc_obj) const
-{
-    process_info_map::const_iterator it =
-        p_reconf_pinfo_map.find(proc_obj);
-    return (it != p_reconf_pinfo_map.end() ? it->second : NULL);
-}
-
 process_support::process_info* process_support::_rc_fetch_process_info(
     sc_object* proc_obj)
 {
@@ -43,6 +43,16 @@
 
 namespace ReChannel {
 
+// the maximum number of idle worker threads kept by a process support
+#ifndef RC_PROCESS_POOL_SIZE
+ #define RC_PROCESS_POOL_SIZE 16
+#endif // RC_PROCESS_POOL_SIZE
+
+// the default stack size of reconfigurable threads (0: kernel default)
+#ifndef RC_PROCESS_STACK_SIZE
+ #define RC_PROCESS_STACK_SIZE 0
+#endif // RC_PROCESS_STACK_SIZE
+
 class rc_process_reset;
 
 namespace internals {
@@ -59,11 +69,30 @@ namespace internals {
  * declaration macros.
  * Furthermore rc_spawn() will be available within that module.
  *
+ * Temporary threads that are spawned by rc_spawn() without a name and
+ * without spawn options are not terminated physically. Instead, they
+ * are kept as idle workers (up to RC_PROCESS_POOL_SIZE) to run the
+ * functions passed to subsequent rc_spawn() calls. An idle worker is
+ * only reused if no rc_process_handle refers to it any more, so the
+ * cancellation and termination semantics of the handles are retained.
+ *
+ * The stack size of reconfigurable threads can be chosen per module
+ * (rc_set_stack_size()) and per process (RC_THREAD_STACK(),
+ * RC_CTHREAD_STACK()). Simple threads may also be declared as
+ * stackless state machines (RC_STACKLESS_THREAD()), which are executed
+ * by a method process and thus do not possess a stack at all.
+ *
+ * Clocked threads declared by RC_CLOCKED_THREAD() wait for the next
+ * clock edge without looking up their process handle: wait() only
+ * tests the process control of the running thread after resumption.
+ * Their static sensitivity already contains the deactivation events.
+ *
  * \remark Only modules that implement rc_resettable can be
  * augmented with the support for resettable processes. Otherwise a
  * runtime error will be reported.
  *
- * \see RC_HAS_PROCESS(), RC_THREAD(), RC_METHOD(), RC_CTHREAD()
+ * \see RC_HAS_PROCESS(), RC_THREAD(), RC_METHOD(), RC_CTHREAD(),
+ *      RC_STACKLESS_THREAD(), RC_CLOCKED_THREAD()
  */
 class process_support
     : public sc_prim_channel
@@ -73,6 +102,7 @@ private:
 
 private:
     typedef rc_hash_map<sc_object*, process_info*> process_info_map;
+    typedef std::vector<process_info*>             process_info_vector;
 
 public:
     process_support();
@@ -89,18 +119,37 @@ public:
     inline rc_reconfigurable* get_reconfigurable_context() const;
 
     void declare_process(
-        const sc_object& host,
-        const boost::function<void (void)>& declare_proc_callback,
+        const sc_object& host, const char* name,
         const boost::function<void (void)>& func, sc_sensitive& sensitive,
+        sc_sensitive_pos& sensitive_pos, sc_sensitive_neg& sensitive_neg,
         bool is_thread=false, bool dont_initialize=false,
-        bool has_sync_reset=false);
+        bool has_sync_reset=false, int stack_size=0,
+        bool is_stackless=false);
 
-    void method_process();
-
-    void thread_process();
+    void declare_clocked_process(
+        const sc_object& host, const char* name,
+        const boost::function<void (void)>& func, sc_sensitive& sensitive,
+        sc_sensitive_pos& sensitive_pos, sc_sensitive_neg& sensitive_neg,
+        int stack_size=0);
 
     void dont_initialize(const sc_object& host) const;
 
+    // waits for n clock cycles (fast path for clocked threads)
+    void clocked_wait(int n=1);
+
+    // sets the stack size of subsequently created threads (0: default)
+    inline void set_stack_size(int stack_size)
+        { p_stack_size = stack_size; }
+
+    inline int get_stack_size() const
+        { return p_stack_size; }
+
+    // returns the resume point of the running stackless thread
+    int& get_resume_point() const;
+
+    // marks the running stackless thread as exited
+    void stackless_exit() const;
+
     // spawns a new, reconfigurable process
      rc_process_handle rc_spawn(
         boost::function<void (void)> func, const char* name_p=NULL,
@@ -130,7 +179,30 @@ protected:
     void before_end_of_elaboration();
 
 private:
-    process_info* _rc_find_process_info(sc_object* proc_obj) const;
+    // the body of a resettable method process
+    void method_process(process_info* pinfo);
+
+    // the body of a resettable thread process
+    void thread_process(process_info* pinfo);
+
+    // the body of a resettable stackless thread (a method process)
+    void stackless_process(process_info* pinfo);
+
+    // the user function of a clocked thread (binds its process info)
+    void clocked_process(
+        process_info* pinfo, const boost::function<void (void)>& func);
+
+    // runs a thread until it is canceled or terminates (if temporary)
+    void _rc_run_thread(process_info& pinfo);
+
+    // parks the current thread as an idle worker
+    bool _rc_park_worker(process_info& pinfo);
+
+    // returns the clocked thread that is currently running (or NULL)
+    inline process_info* _rc_get_curr_clocked();
+
+    // returns an idle worker that is safe to be reused (or NULL)
+    process_info* _rc_fetch_idle_worker();
 
     process_info* _rc_fetch_process_info(sc_object* proc_obj);
 
@@ -159,6 +231,11 @@ private:
     process_info*      p_last_pinfo;
     const sc_object*   p_last_host;
     unsigned int       p_last_host_child_count;
+    process_info_vector p_idle_workers;
+    int                p_stack_size;
+    process_info*      p_curr_stackless;
+    process_info*      p_curr_clocked;
+    sc_process_b*      p_curr_clocked_proc;
 };
 
 /**
@@ -170,9 +247,9 @@ class process_support::process_info
 private:
     typedef std::vector<const rc_reset_channel_if*> reset_channel_vector;
     typedef std::vector<const sc_in<bool>*>         reset_port_vector;
-    typedef internals::reset_signal                 reset_signal;
-    typedef std::map<const sc_signal_in_if<bool>*, reset_signal*>
-                                                    reset_signal_map;
+    typedef internals::reset_monitor                reset_monitor;
+    typedef std::map<const sc_signal_in_if<bool>*, reset_monitor*>
+                                                    reset_monitor_map;
 public:
     process_info(
         boost::function<void (void)> func_,
@@ -200,6 +277,30 @@ public:
     inline void set_init_run(bool b)
         { p_is_init_run = b; }
 
+    inline bool is_poolable() const
+        { return p_is_poolable; }
+
+    inline void set_poolable(bool b)
+        { p_is_poolable = b; }
+
+    inline bool is_stackless() const
+        { return p_is_stackless; }
+
+    inline void set_stackless(bool b)
+        { p_is_stackless = b; }
+
+    inline bool is_clocked() const
+        { return p_is_clocked; }
+
+    inline void set_clocked(bool b)
+        { p_is_clocked = b; }
+
+    inline bool is_started() const
+        { return p_is_started; }
+
+    inline void set_started(bool b)
+        { p_is_started = b; }
+
     void register_reset_channel(
         const rc_reset_channel_if& reset_channel, bool active_level);
 
@@ -222,22 +323,33 @@ private:
     static const rc_reset_channel_if& _rc_get_reset_channel(
         const sc_signal_in_if<bool>& signal_interface);
 
-    static void _rc_reset_updater_proc(
-        const sc_signal_in_if<bool>& from_, reset_signal& to_);
-
 public:
     boost::function<void (void)> func;
     rc_process_control     process_control;
+    // (is set as soon as the process has been created)
+    rc_process_handle      hproc;
+    // (is kept while the thread is an idle worker)
+    sc_process_handle      worker_proc;
+    sc_event               worker_event;
+    // (the state of a stackless thread, see RC_STACKLESS_BEGIN)
+    int                    resume_point;
+
+public:
+    enum { resume_exited = -1 };
 
 private:
     bool                   p_is_thread          : 1;
     bool                   p_is_dont_initialize : 1;
     bool                   p_is_init_run        : 1;
+    bool                   p_is_poolable        : 1;
+    bool                   p_is_stackless       : 1;
+    bool                   p_is_started         : 1;
+    bool                   p_is_clocked         : 1;
     reset_channel_vector   p_reset_channels[2];
     reset_port_vector      p_reset_ports[2];
 
 private:
-    static reset_signal_map p_reset_signal_map;
+    static reset_monitor_map p_reset_monitor_map;
 };
 
 } // namespace internals
@@ -318,6 +430,18 @@ rc_reconfigurable* process_support::get_reconfigurable_context() const
     }
 }
 
+inline
+process_support::process_info* process_support::_rc_get_curr_clocked()
+{
+    // (the binding is only valid while its clocked thread is running)
+    if (p_curr_clocked != NULL
+    && p_curr_clocked_proc == sc_get_current_process_b())
+    {
+        return p_curr_clocked;
+    }
+    return NULL;
+}
+
 } // namespace internals
 
 } // namespace ReChannel
@@ -329,14 +453,6 @@ rc_reconfigurable* process_support::get_reconfigurable_context() const
     private: \
         internals::process_support \
             _rc_process_support; \
-        void _rc_declare_method() \
-            { SC_METHOD(_rc_method_process); } \
-        void _rc_declare_thread() \
-            { SC_THREAD(_rc_thread_process); } \
-        void _rc_method_process() \
-            { this->_rc_process_support.method_process(); } \
-        void _rc_thread_process() \
-            { this->_rc_process_support.thread_process(); } \
     protected: \
         inline void next_trigger() \
             { rc_next_trigger(); } \
@@ -366,9 +482,9 @@ rc_reconfigurable* process_support::get_reconfigurable_context() const
             double v, sc_time_unit tu, sc_event_and_list& el) \
             { rc_next_trigger(v, tu, el); } \
         inline void wait() \
-            { rc_wait(); } \
+            { this->_rc_process_support.clocked_wait(); } \
         inline void wait(int n) \
-            { rc_wait(n); } \
+            { this->_rc_process_support.clocked_wait(n); } \
         inline void wait(const sc_event& e) \
             { rc_wait(e); } \
         inline void wait(sc_event_or_list& el) \
@@ -406,6 +522,8 @@ rc_reconfigurable* process_support::get_reconfigurable_context() const
         } \
         inline void rc_terminate() \
             { this->_rc_process_support.terminate(); } \
+        inline void rc_set_stack_size(int stack_size) \
+            { this->_rc_process_support.set_stack_size(stack_size); } \
     public: \
         inline void dont_initialize() \
         { \
@@ -452,12 +570,11 @@ rc_reconfigurable* process_support::get_reconfigurable_context() const
     if (true) { \
         if (this->_rc_process_support.has_reconfigurable_context()) { \
             this->_rc_process_support.declare_process( \
-                *this, \
-                boost::bind( \
-                    &RC_CURRENT_USER_MODULE::_rc_declare_method, this), \
+                *this, #func, \
                 boost::bind( \
                     &RC_CURRENT_USER_MODULE::func, this), \
-                this->sensitive); \
+                this->sensitive, this->sensitive_pos, \
+                this->sensitive_neg); \
         } else { \
             SC_METHOD(func); \
         } \
@@ -466,26 +583,66 @@ rc_reconfigurable* process_support::get_reconfigurable_context() const
 #define RC_RECONFIGURABLE_THREAD(func) \
     if (true) { \
         this->_rc_process_support.declare_process( \
-            *this, \
-            boost::bind( \
-                &RC_CURRENT_USER_MODULE::_rc_declare_thread, this), \
+            *this, #func, \
             boost::bind( \
                 &RC_CURRENT_USER_MODULE::func, this), \
-            this->sensitive, true, false, false); \
+            this->sensitive, this->sensitive_pos, \
+            this->sensitive_neg, true, false, false); \
     } else (void)0
 
 #define RC_RECONFIGURABLE_CTHREAD(func, edge) \
     if (true) { \
         this->_rc_process_support.declare_process( \
-            *this, \
+            *this, #func, \
             boost::bind( \
-                &RC_CURRENT_USER_MODULE::_rc_declare_thread, this), \
+                &RC_CURRENT_USER_MODULE::func, this), \
+            this->sensitive, this->sensitive_pos, \
+            this->sensitive_neg, true, true, true); \
+        this->sensitive << edge; \
+    } else (void)0
+
+#define RC_RECONFIGURABLE_THREAD_STACK(func, stack_size) \
+    if (true) { \
+        this->_rc_process_support.declare_process( \
+            *this, #func, \
             boost::bind( \
                 &RC_CURRENT_USER_MODULE::func, this), \
-            this->sensitive, true, true, true); \
+            this->sensitive, this->sensitive_pos, \
+            this->sensitive_neg, true, false, false, stack_size); \
+    } else (void)0
+
+#define RC_RECONFIGURABLE_CTHREAD_STACK(func, edge, stack_size) \
+    if (true) { \
+        this->_rc_process_support.declare_process( \
+            *this, #func, \
+            boost::bind( \
+                &RC_CURRENT_USER_MODULE::func, this), \
+            this->sensitive, this->sensitive_pos, \
+            this->sensitive_neg, true, true, true, stack_size); \
         this->sensitive << edge; \
     } else (void)0
 
+#define RC_RECONFIGURABLE_CLOCKED_THREAD(func, edge) \
+    if (true) { \
+        this->_rc_process_support.declare_clocked_process( \
+            *this, #func, \
+            boost::bind( \
+                &RC_CURRENT_USER_MODULE::func, this), \
+            this->sensitive, this->sensitive_pos, \
+            this->sensitive_neg); \
+        this->sensitive << edge; \
+    } else (void)0
+
+#define RC_RECONFIGURABLE_STACKLESS_THREAD(func) \
+    if (true) { \
+        this->_rc_process_support.declare_process( \
+            *this, #func, \
+            boost::bind( \
+                &RC_CURRENT_USER_MODULE::func, this), \
+            this->sensitive, this->sensitive_pos, \
+            this->sensitive_neg, false, false, false, 0, true); \
+    } else (void)0
+
 #define RC_NO_RECONFIGURABLE_PROCESS_RESET(pbc_name) \
     for(rc_process_behavior_change pbc_name = \
         this->_rc_process_support.disable_process_control(); \
@@ -504,6 +661,85 @@ rc_reconfigurable* process_support::get_reconfigurable_context() const
 #define RC_CTHREAD(func, edge) \
     RC_RECONFIGURABLE_CTHREAD(func, edge)
 
+#define RC_THREAD_STACK(func, stack_size) \
+    RC_RECONFIGURABLE_THREAD_STACK(func, stack_size)
+
+#define RC_CTHREAD_STACK(func, edge, stack_size) \
+    RC_RECONFIGURABLE_CTHREAD_STACK(func, edge, stack_size)
+
+#define RC_CLOCKED_THREAD(func, edge) \
+    RC_RECONFIGURABLE_CLOCKED_THREAD(func, edge)
+
+#define RC_STACKLESS_THREAD(func) \
+    RC_RECONFIGURABLE_STACKLESS_THREAD(func)
+
+/* stackless thread bodies */
+
+/*
+ * The body of a stackless thread is a state machine that is resumed at
+ * its last wait statement each time the process is triggered. Local
+ * variables are not preserved across wait statements (use members
+ * instead), and wait statements must not be placed inside a nested
+ * switch statement. Reset and cancellation restart the body at
+ * RC_STACKLESS_BEGIN.
+ *
+ * The resume points are numbered by __COUNTER__. Compilers that lack
+ * __COUNTER__ fall back to __LINE__, in which case at most one wait
+ * statement may be placed on a single line (and within a single macro
+ * expansion).
+ *
+ * Example:
+ * \code
+ * void proc() {
+ *     RC_STACKLESS_BEGIN;
+ *     count = 0;
+ *     while (true) {
+ *         RC_STACKLESS_WAIT(clk.posedge_event());
+ *         ++count;
+ *     }
+ *     RC_STACKLESS_END;
+ * }
+ * \endcode
+ */
+
+#define RC_STACKLESS_BEGIN \
+    int& _rc_resume_point = \
+        this->_rc_process_support.get_resume_point(); \
+    switch (_rc_resume_point) { \
+    case 0:
+
+#ifdef __COUNTER__
+#define _RC_STACKLESS_YIELD \
+    _RC_STACKLESS_YIELD_AT(__COUNTER__ + 1)
+#else
+#define _RC_STACKLESS_YIELD \
+    _RC_STACKLESS_YIELD_AT(__LINE__)
+#endif // __COUNTER__
+
+// (label is expanded before substitution, i.e. it is evaluated once)
+#define _RC_STACKLESS_YIELD_AT(label) \
+    do { \
+        _rc_resume_point = label; \
+        return; \
+        case label: ; \
+    } while (false)
+
+#define RC_STACKLESS_WAIT(trigger) \
+    do { \
+        rc_next_trigger(trigger); \
+        _RC_STACKLESS_YIELD; \
+    } while (false)
+
+#define RC_STACKLESS_WAIT_STATIC \
+    do { \
+        rc_next_trigger(); \
+        _RC_STACKLESS_YIELD; \
+    } while (false)
+
+#define RC_STACKLESS_END \
+    } \
+    this->_rc_process_support.stackless_exit()
+
 #define RC_NO_RESET \
     RC_NO_RECONFIGURABLE_PROCESS_RESET(_rc_tmp_pbc)
 
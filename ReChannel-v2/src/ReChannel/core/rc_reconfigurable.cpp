@@ -36,6 +36,9 @@
 
 #include "rc_reconfigurable.h"
 #include "rc_control.h"
+#include "ReChannel/util/rc_profiler.h"
+
+#include <algorithm>
 
 namespace ReChannel {
 
@@ -77,11 +80,20 @@ std::vector<rc_reconfigurable*> rc_reconfigurable::s_reconfigurables;
 rc_reconfigurable::rc_reconfigurable(sc_object* this_)
     : p_sc_object(this_), p_is_no_sc_object(false),
       p_state(UNLOADED), p_next_state(UNLOADED),
-      p_transaction_count(0),
+      p_transaction_count(0), p_tagged_transaction_count(0),
+      p_transaction_epoch(0),
       p_switch_commobj_index(p_switch_commobj_map.get<0>()),
       p_commobj_switch_index(p_switch_commobj_map.get<1>()),
-      p_control(NULL), p_curr_switch_conn(NULL)
+      p_control(NULL), p_curr_switch_conn(NULL),
+      p_is_resettable_init_done(false),
+      p_has_preemption_deadline(false), p_has_saved_context(false),
+      p_is_context_preserving(false), p_is_temporally_decoupled(false),
+      p_has_unlock_proc(false), p_preemption_count(0),
+      p_pending_lock_deltas(0)
 {
+    for (int i=0; i < ACTION_COUNT; i++) {
+        p_action_count[i] = 0;
+    }
     p_self_set.insert(*this);
 
     p_delta_sync.set_callback(
@@ -161,12 +173,42 @@ bool rc_reconfigurable::rc_is_registered(rc_switch& switch_obj) const
 
 void rc_reconfigurable::rc_register_resettable(rc_resettable& resettable)
 {
-    p_resettable_set.insert(&resettable);
+    if (resettable.p_reset_context == NULL) {
+        resettable.p_reset_context = this;
+    } else if (this->rc_is_registered(resettable)) {
+        return;
+    }
+    p_resettable_vector.push_back(&resettable);
+    if (p_is_resettable_init_done) {
+        // the state of a late registered resettable is unknown
+        this->_rc_init_dirty_tracking(resettable);
+        resettable.rc_set_dirty();
+    }
+}
+
+void rc_reconfigurable::rc_unregister_resettable(rc_resettable& resettable)
+{
+    resettable_vector* const vectors[3] = {
+        &p_resettable_vector, &p_untracked_resettable_vector,
+        &p_dirty_resettable_vector };
+    for (int i=0; i < 3; ++i) {
+        resettable_vector& vec = *vectors[i];
+        vec.erase(
+            std::remove(vec.begin(), vec.end(), &resettable), vec.end());
+    }
+    if (resettable.p_reset_context == this) {
+        resettable.p_reset_context = NULL;
+        resettable.p_is_dirty_tracked = false;
+        resettable.p_is_dirty = true;
+    }
 }
 
 bool rc_reconfigurable::rc_is_registered(rc_resettable& resettable) const
 {
-    return (p_resettable_set.find(&resettable) != p_resettable_set.end());
+    return (resettable.p_reset_context == this
+        || std::find(p_resettable_vector.begin(),
+               p_resettable_vector.end(), &resettable)
+           != p_resettable_vector.end());
 }
 
 void rc_reconfigurable::rc_possible_deactivation()
@@ -210,6 +252,48 @@ void rc_reconfigurable::rc_set_delay(action_type a, sc_time t)
     }
 }
 
+void rc_reconfigurable::rc_set_preemption_deadline(const sc_time& deadline)
+{
+    p_preemption_deadline = deadline;
+    p_has_preemption_deadline = true;
+}
+
+void rc_reconfigurable::rc_clear_preemption_deadline()
+{
+    p_preemption_deadline = SC_ZERO_TIME;
+    p_has_preemption_deadline = false;
+}
+
+sc_time rc_reconfigurable::rc_get_state_time(state_type s) const
+{
+    const sc_time now = sc_time_stamp();
+    // (a decoupled state change may lie ahead of the simulation time)
+    if (s == p_state && now > p_state_entry_time) {
+        // include the time spent in the current state
+        return p_state_time[s] + (now - p_state_entry_time);
+    } else {
+        return p_state_time[s];
+    }
+}
+
+void rc_reconfigurable::rc_reset_statistics()
+{
+    for (int i=0; i < STATE_COUNT; i++) {
+        p_state_time[i] = SC_ZERO_TIME;
+    }
+    p_state_entry_time = sc_time_stamp();
+    for (int i=0; i < ACTION_COUNT; i++) {
+        p_action_count[i] = 0;
+    }
+    p_drain_wait_time = SC_ZERO_TIME;
+    p_max_drain_wait_time = SC_ZERO_TIME;
+    p_lock_wait_time = SC_ZERO_TIME;
+    p_max_lock_wait_time = SC_ZERO_TIME;
+    p_preemption_count = 0;
+    p_preemption_latency_saved = SC_ZERO_TIME;
+    p_phase_profile.clear();
+}
+
 void rc_reconfigurable::rc_add_filter(
     const rc_object_handle& commobj_, rc_interface_filter& filter_)
 {
@@ -222,7 +306,22 @@ void rc_reconfigurable::rc_add_filter(
 
     // insert filter
     p_filter_set.insert(&filter_);
-    p_commobj_filters_map[commobj_].push_back(&filter_);
+    filter_chain& chain = p_commobj_filters_map[commobj_];
+    chain.push_back(&filter_);
+
+#ifdef RC_ENABLE_PROFILER
+    // name the filter after its communication object and chain position
+    std::ostringstream filter_name;
+    if (commobj_.valid()) {
+        filter_name << commobj_->name();
+    } else {
+        filter_name << this->rc_get_name();
+    }
+    filter_name << "/filter" << (chain.size() - 1);
+    RC_PROFILER_SET_FILTER(
+        static_cast<const rc_interface_filter*>(&filter_),
+        filter_name.str());
+#endif // RC_ENABLE_PROFILER
 }
 
 int rc_reconfigurable::rc_get_filter_count(
@@ -279,12 +378,15 @@ void rc_reconfigurable::rc_refresh_notify_all()
 void rc_reconfigurable::start_of_simulation()
 {
     // initialise all registered resettables
-    for (resettable_set::const_iterator it = p_resettable_set.begin();
-        it != p_resettable_set.end();
+    for (resettable_vector::const_iterator it =
+            p_resettable_vector.begin();
+        it != p_resettable_vector.end();
         ++it)
     {
         (*it)->rc_on_init_resettable();
+        this->_rc_init_dirty_tracking(*(*it));
     }
+    p_is_resettable_init_done = true;
 
     // initialise switch states
     switch(p_state) {
@@ -306,10 +408,23 @@ void rc_reconfigurable::start_of_simulation()
 
 void rc_reconfigurable::reconfigure(state_type new_state)
 {
+    const sc_time start_time = sc_time_stamp();
+    const sc_dt::uint64 start_delta = sc_delta_count();
     const bool has_lock_share_ = has_lock_share();
     if (!has_lock_share_) {
+        RC_TRACE_BEGIN(this, this->rc_get_name(), LOCK_WAIT);
         p_mutex.lock();
+        RC_TRACE_END(this, this->rc_get_name(), LOCK_WAIT);
     }
+    // start a new phase record (including a preceding lock by the control)
+    p_phase_record.clear();
+    p_phase_record.start_time = start_time;
+    p_phase_record.phase_time[rc_phase_record::LOCK_PHASE] =
+        (sc_time_stamp() - start_time) + p_pending_lock_time;
+    p_phase_record.phase_deltas[rc_phase_record::LOCK_PHASE] =
+        (sc_delta_count() - start_delta) + p_pending_lock_deltas;
+    p_pending_lock_time = SC_ZERO_TIME;
+    p_pending_lock_deltas = 0;
     try {
         switch(p_state) {
         case UNLOADED:
@@ -357,6 +472,9 @@ void rc_reconfigurable::reconfigure(state_type new_state)
         }
         throw;
     }
+    if (sc_is_running()) {
+        p_phase_profile.add(p_phase_record);
+    }
     if (!has_lock_share_) {
         p_mutex.unlock();
     }
@@ -372,6 +490,13 @@ void rc_reconfigurable::change_switch_state(
     {
         rc_switch& switch_ = *(it->first);
 
+        // don't interfere with another (active) reconfigurable
+        if (switch_.is_exclusively_locked()
+        && !switch_.is_exclusive_lock_owner(*this))
+        {
+            continue;
+        }
+
         switch(new_state) {
         case rc_switch::OPEN:
         {
@@ -442,6 +567,11 @@ bool rc_reconfigurable::unlock()
     if (has_unlocked && p_lock_share.valid()) {
         p_lock_share = sc_process_handle();
     }
+    if (!p_mutex.is_locked()) {
+        // discard a lock wait that was not followed by a reconfiguration
+        p_pending_lock_time = SC_ZERO_TIME;
+        p_pending_lock_deltas = 0;
+    }
     return has_unlocked;
 }
 
@@ -465,62 +595,98 @@ bool rc_reconfigurable::reset_lock_share()
     }
 }
 
-bool rc_reconfigurable::lock_switches(bool report_error)
+void rc_reconfigurable::lock_switches()
 {
-    int unlocked_count = 0;
-    // check whether all of the switches can be locked
+    // lock the switches (shared with other loaded reconfigurables)
     for (switch_commobj_index::iterator it =
             p_switch_commobj_index.begin();
         it != p_switch_commobj_index.end();
         ++it)
     {
         rc_switch& switch_ = *(it->first);
+        // (only a switch without shadow loading refuses a shared lock)
+        if (!switch_.set_locked(*this, true)) {
+            this->unlock_switches();
+            RC_REPORT_ERROR(RC_ID_SWITCH_CONFLICT_,
+                "switch '" << switch_.get_switch_name()
+                << "' is already in use by another reconfigurable"
+                " object (in reconfigurable '" << this->rc_get_name()
+                << "')");
+        }
+    }
+}
 
-        if (!switch_.is_lock_owner(*this)) {
-            if (!switch_.is_locked()) {
-                ++unlocked_count;
-            } else {
-                // failure, lock hold by another module
-                if (report_error) {
-                    RC_REPORT_ERROR(RC_ID_SWITCH_CONFLICT_,
-                        "switch '" << switch_.get_switch_name()
-                        << "' is already in use by another reconfigurable object"
-                        << " (in reconfigurable '" << this->rc_get_name()
-                        << "')");
-                } else {
-                    return false;
-                }
+void rc_reconfigurable::unlock_switches()
+{
+    // unlock the switches locked by this reconfigurable object
+    for (switch_commobj_index::iterator it =
+            p_switch_commobj_index.begin();
+        it != p_switch_commobj_index.end();
+        ++it)
+    {
+        rc_switch& switch_ = *(it->first);
+        switch_.set_locked(*this, false);
+    }
+}
+
+bool rc_reconfigurable::lock_switches_exclusively(bool report_error)
+{
+    // check whether all of the switches can be locked exclusively
+    for (switch_commobj_index::iterator it =
+            p_switch_commobj_index.begin();
+        it != p_switch_commobj_index.end();
+        ++it)
+    {
+        rc_switch& switch_ = *(it->first);
+
+        if (!switch_.is_exclusive_lock_owner(*this)
+        && switch_.is_exclusively_locked())
+        {
+            // failure, lock hold by another (active) module
+            if (report_error) {
+                RC_REPORT_ERROR(RC_ID_SWITCH_CONFLICT_,
+                    "switch '" << switch_.get_switch_name()
+                    << "' is already in use by another reconfigurable"
+                    " object (in reconfigurable '" << this->rc_get_name()
+                    << "')");
             }
+            return false;
         }
     }
-    // lock the switches (if necessary)
-    if (unlocked_count > 0) {
-        bool succ = false;
-        for (switch_commobj_index::iterator it =
-                p_switch_commobj_index.begin();
-            it != p_switch_commobj_index.end();
-            ++it)
-        {
-            rc_switch& switch_ = *(it->first);
+    // lock the switches
+    for (switch_commobj_index::iterator it =
+            p_switch_commobj_index.begin();
+        it != p_switch_commobj_index.end();
+        ++it)
+    {
+        rc_switch& switch_ = *(it->first);
 
-            // the previous check loop should guarantee a success
-            succ = switch_.set_locked(*this, true);
-            assert(succ == true);
+        if (!switch_.set_exclusively_locked(*this, true)) {
+            // failure, the switch refuses to be locked
+            if (report_error) {
+                RC_REPORT_ERROR(RC_ID_SWITCH_CONFLICT_,
+                    "switch '" << switch_.get_switch_name()
+                    << "' cannot be locked exclusively"
+                    << " (in reconfigurable '" << this->rc_get_name()
+                    << "')");
+            }
+            unlock_switches_exclusively();
+            return false;
         }
     }
     return true;
 }
 
-void rc_reconfigurable::unlock_switches()
+void rc_reconfigurable::unlock_switches_exclusively()
 {
-    // unlock the switches locked by this reconfigurable object
+    // release the exclusive lock held by this reconfigurable object
     for (switch_commobj_index::iterator it =
             p_switch_commobj_index.begin();
         it != p_switch_commobj_index.end();
         ++it)
     {
         rc_switch& switch_ = *(it->first);
-        switch_.set_locked(*this, false);
+        switch_.set_exclusively_locked(*this, false);
     }
 }
 
@@ -532,6 +698,20 @@ void rc_reconfigurable::reset_transaction_count()
     }
 }
 
+void rc_reconfigurable::_rc_end_discarded_transaction(unsigned int epoch)
+{
+    preemption_map::iterator it = p_preemption_map.find(epoch);
+    if (it == p_preemption_map.end()) {
+        // the preemption has been forgotten on unload
+        return;
+    }
+    // the last discarded transaction of this preemption has completed
+    if (--it->second.pending_count <= 0) {
+        p_preemption_latency_saved += sc_time_stamp() - it->second.time;
+        p_preemption_map.erase(it);
+    }
+}
+
 void rc_reconfigurable::rc_add_portmap(rc_portmap_base& portmap)
 {
     sc_object* const this_obj = this->rc_get_object();
@@ -647,7 +827,7 @@ void rc_reconfigurable::_rc_delta_sync_state_change(
 
     if (p_state == INACTIVE && p_next_state == ACTIVE) {
         // activate reconfigurable object
-        p_state = ACTIVE;
+        _rc_set_state(ACTIVE);
         p_delta_sync.set_enabled(false);
         p_pctrl.activate();
         change_switch_state(rc_switch::OPEN);
@@ -655,10 +835,11 @@ void rc_reconfigurable::_rc_delta_sync_state_change(
         // check whether reconfigurable object is ready to be deactivated
         if (p_transaction_count == 0) {
             // deactivate reconfigurable object
-            p_state = INACTIVE;
+            _rc_set_state(INACTIVE);
             p_delta_sync.set_enabled(false);
             p_pctrl.deactivate();
             change_switch_state(rc_switch::CLOSED);
+            unlock_switches_exclusively();
         }
     } else {
         RC_REPORT_ERROR(RC_ID_INTERNAL_ERROR_, "internal error");
@@ -667,96 +848,277 @@ void rc_reconfigurable::_rc_delta_sync_state_change(
 
 void rc_reconfigurable::_rc_unload()
 {
+    RC_TRACE_BEGIN(this, this->rc_get_name(), UNLOAD);
+    ++p_action_count[UNLOAD];
     p_next_state = UNLOADED;
     if (sc_is_running()) {
-        sc_time delay = rc_get_delay(UNLOAD);
-        if (delay != SC_ZERO_TIME) {
-            ::sc_core::wait(delay);
+        _rc_consume_delay(rc_get_delay(UNLOAD));
+        _rc_set_state(UNLOADED);
+        const sc_time offset = rc_local_time::get_offset();
+        if (offset == SC_ZERO_TIME) {
+            unlock_switches();
+        } else {
+            // the unload completes at the local time
+            _rc_unlock_switches_at(offset);
+        }
+        // forget the transactions discarded by preemptions
+        p_preemption_map.clear();
+        if (p_has_saved_context) {
+            // discard the saved context
+            _rc_reset();
+            p_has_saved_context = false;
+        }
+        {
+            internals::phase_stopwatch sw(
+                p_phase_record, rc_phase_record::CALLBACK_PHASE);
+            rc_on_unload();
         }
-        p_state = UNLOADED;
-        unlock_switches();
-        rc_on_unload();
     } else {
-        p_state = UNLOADED;
+        _rc_set_state(UNLOADED);
         unlock_switches();
     }
+    RC_TRACE_END(this, this->rc_get_name(), UNLOAD);
 }
 
 void rc_reconfigurable::_rc_load()
 {
+    RC_TRACE_BEGIN(this, this->rc_get_name(), LOAD);
+    ++p_action_count[LOAD];
     p_next_state = INACTIVE;
-    lock_switches(true);
+    p_has_saved_context = false;
+    {
+        internals::phase_stopwatch sw(
+            p_phase_record, rc_phase_record::SWITCH_LOCK_PHASE);
+        lock_switches();
+    }
     if (sc_is_running()) {
-        sc_time delay = rc_get_delay(LOAD);
-        if (delay != SC_ZERO_TIME) {
-            ::sc_core::wait(delay);
-        }
-        p_state = INACTIVE;
+        _rc_consume_delay(rc_get_delay(LOAD));
+        _rc_set_state(INACTIVE);
+        internals::phase_stopwatch sw(
+            p_phase_record, rc_phase_record::CALLBACK_PHASE);
         rc_on_load();
     } else {
-        p_state = INACTIVE;
+        _rc_set_state(INACTIVE);
     }
+    RC_TRACE_END(this, this->rc_get_name(), LOAD);
 }
 
 void rc_reconfigurable::_rc_activate()
 {
+    RC_TRACE_BEGIN(this, this->rc_get_name(), ACTIVATE);
+    {
+        internals::phase_stopwatch sw(
+            p_phase_record, rc_phase_record::SWITCH_LOCK_PHASE);
+        if (!lock_switches_exclusively(true)) {
+            // the module remains inactive
+            RC_TRACE_END(this, this->rc_get_name(), ACTIVATE);
+            return;
+        }
+    }
+    ++p_action_count[ACTIVATE];
     p_next_state = ACTIVE;
     if (sc_is_running()) {
-        // reset all registered resettables
-        _rc_reset();
+        if (p_has_saved_context) {
+            // resume from the saved context
+            _rc_restore_context();
+        } else {
+            // reset all registered resettables
+            _rc_reset();
+        }
         // wait activation time (wait at least for one delta cycle)
-        ::sc_core::wait(rc_get_delay(ACTIVATE));
-
-        p_delta_sync.set_enabled(true);
-        p_delta_sync.request_update();
-        ::sc_core::wait(p_pctrl.get_activation_event());
+        {
+            internals::phase_stopwatch sw(
+                p_phase_record, rc_phase_record::DELAY_PHASE);
+            // the handshake requires the local time to be in sync
+            rc_local_time::sync(rc_get_delay(ACTIVATE), true);
+        }
+        {
+            internals::phase_stopwatch sw(
+                p_phase_record, rc_phase_record::DELTA_SYNC_PHASE);
+            p_delta_sync.set_enabled(true);
+            p_delta_sync.request_update();
+            ::sc_core::wait(p_pctrl.get_activation_event());
+        }
         assert(p_state == ACTIVE);
-        rc_on_activate();
+        {
+            internals::phase_stopwatch sw(
+                p_phase_record, rc_phase_record::CALLBACK_PHASE);
+            rc_on_activate();
+        }
     } else {
-        p_state = ACTIVE;
+        _rc_set_state(ACTIVE);
     }
+    RC_TRACE_END(this, this->rc_get_name(), ACTIVATE);
 }
 
 void rc_reconfigurable::_rc_deactivate()
 {
+    RC_TRACE_BEGIN(this, this->rc_get_name(), DEACTIVATE);
+    ++p_action_count[DEACTIVATE];
     p_next_state = INACTIVE;
     if (sc_is_running()) {
-        p_delta_sync.set_enabled(true);
-        p_delta_sync.request_update();
-        ::sc_core::wait(p_pctrl.get_deactivation_event());
+        // the handshake requires the local time to be in sync
+        rc_local_time::sync();
+        bool is_preempted = false;
+        {
+            internals::phase_stopwatch sw(
+                p_phase_record, rc_phase_record::DELTA_SYNC_PHASE);
+            p_delta_sync.set_enabled(true);
+            p_delta_sync.request_update();
+            // wait until the pending transactions are drained
+            RC_TRACE_BEGIN(this, this->rc_get_name(), DRAIN_WAIT);
+            const sc_time drain_start = sc_time_stamp();
+            if (p_has_preemption_deadline) {
+                ::sc_core::wait(
+                    p_preemption_deadline,
+                    p_pctrl.get_deactivation_event());
+                if (p_state == ACTIVE) {
+                    // deadline exceeded, discard the pending transactions
+                    _rc_preempt();
+                    is_preempted = true;
+                    ::sc_core::wait(p_pctrl.get_deactivation_event());
+                }
+            } else {
+                ::sc_core::wait(p_pctrl.get_deactivation_event());
+            }
+            RC_TRACE_END(this, this->rc_get_name(), DRAIN_WAIT);
+            const sc_time drain_time = sc_time_stamp() - drain_start;
+            p_drain_wait_time += drain_time;
+            if (drain_time > p_max_drain_wait_time) {
+                p_max_drain_wait_time = drain_time;
+            }
+        }
         assert(p_state == INACTIVE);
-        sc_time delay = rc_get_delay(DEACTIVATE);
-        if (delay != SC_ZERO_TIME) {
-            ::sc_core::wait(delay);
+        _rc_consume_delay(rc_get_delay(DEACTIVATE));
+        {
+            internals::phase_stopwatch sw(
+                p_phase_record, rc_phase_record::CALLBACK_PHASE);
+            rc_on_deactivate();
+        }
+        if (is_preempted || p_is_context_preserving) {
+            // preserve the context until the next activation
+            _rc_save_context();
+        } else {
+            _rc_reset(); // reset all registered resettables
         }
-        rc_on_deactivate();
-        _rc_reset(); // reset all registered resettables
     } else {
-        p_state = INACTIVE;
+        _rc_set_state(INACTIVE);
+        unlock_switches_exclusively();
+    }
+    RC_TRACE_END(this, this->rc_get_name(), DEACTIVATE);
+}
+
+void rc_reconfigurable::_rc_consume_delay(const sc_time& delay)
+{
+    // (a decoupled delay is accounted at the local time)
+    internals::phase_stopwatch sw(
+        p_phase_record, rc_phase_record::DELAY_PHASE,
+        p_is_temporally_decoupled);
+    if (p_is_temporally_decoupled) {
+        // run ahead and synchronise at the quantum boundary only
+        rc_local_time::inc(delay);
+        if (rc_local_time::need_sync()) {
+            rc_local_time::sync();
+        }
+    } else {
+        // (a caller that runs ahead is synchronised)
+        rc_local_time::sync(delay);
+    }
+}
+
+void rc_reconfigurable::_rc_set_state(state_type new_state)
+{
+    if (new_state != p_state) {
+        const sc_time now = (p_is_temporally_decoupled && sc_is_running()
+            ? rc_local_time::get_current_time() : sc_time_stamp());
+        if (now > p_state_entry_time) {
+            p_state_time[p_state] += now - p_state_entry_time;
+            p_state_entry_time = now;
+        }
+        p_state = new_state;
+    }
+}
+
+void rc_reconfigurable::_rc_unlock_switches_at(const sc_time& delay)
+{
+    if (!p_has_unlock_proc) {
+        sc_spawn_options opt;
+        opt.spawn_method();
+        opt.dont_initialize();
+        opt.set_sensitivity(&p_unlock_event);
+        sc_spawn(
+            boost::bind(&rc_reconfigurable::_rc_unlock_proc, this),
+            sc_gen_unique_name("_rc_unlock_proc"), &opt);
+        p_has_unlock_proc = true;
+    }
+    // (a later unload supersedes a pending one)
+    p_unlock_event.cancel();
+    p_unlock_event.notify(delay);
+}
+
+void rc_reconfigurable::_rc_unlock_proc()
+{
+    // (the reconfigurable may have been loaded again in the meantime)
+    if (p_state == UNLOADED) {
+        unlock_switches();
+    }
+}
+
+void rc_reconfigurable::_rc_add_lock_wait_time(
+    const sc_time& t, sc_dt::uint64 deltas)
+{
+    // accounted to the lock phase of the next reconfiguration
+    p_pending_lock_time += t;
+    p_pending_lock_deltas += deltas;
+
+    p_lock_wait_time += t;
+    if (t > p_max_lock_wait_time) {
+        p_max_lock_wait_time = t;
     }
 }
 
 void rc_reconfigurable::_rc_reset()
 {
+    internals::phase_stopwatch sw(
+        p_phase_record, rc_phase_record::RESET_PHASE);
     const sc_dt::uint64 curr_delta = sc_delta_count();
     const sc_time start_time = sc_time_stamp();
     bool has_consumed_deltas = false;
 
-    // reset all registered resettables
-    for (resettable_set::const_iterator it = p_resettable_set.begin();
-        it != p_resettable_set.end();
+    // only the resettables modified since the last reset are reset
+    resettable_vector dirty_vector;
+    dirty_vector.swap(p_dirty_resettable_vector);
+    for (resettable_vector::const_iterator it = dirty_vector.begin();
+        it != dirty_vector.end();
         ++it)
     {
-        // reset the resettable
-        (*it)->rc_on_reset();
+        (*it)->p_is_dirty = false;
+    }
 
-        // check whether any delta cycles were consumed
-        if (has_consumed_deltas == false
-        && sc_delta_count() != curr_delta)
+    // reset the untracked and the modified resettables
+    const resettable_vector* const vectors[2] = {
+        &p_untracked_resettable_vector, &dirty_vector };
+    for (int i=0; i < 2; ++i) {
+        for (resettable_vector::const_iterator it = vectors[i]->begin();
+            it != vectors[i]->end();
+            ++it)
         {
-            has_consumed_deltas = true;
+            // reset the resettable
+            (*it)->rc_on_reset();
+
+            // check whether any delta cycles were consumed
+            if (has_consumed_deltas == false
+            && sc_delta_count() != curr_delta)
+            {
+                has_consumed_deltas = true;
+            }
         }
     }
+    // reuse the allocated memory
+    if (p_dirty_resettable_vector.empty()) {
+        dirty_vector.clear();
+        p_dirty_resettable_vector.swap(dirty_vector);
+    }
     // report a warning if at least one of the resettables consumed time
     if (has_consumed_deltas) {
         const sc_time time_consumed = sc_time_stamp() - start_time;
@@ -777,10 +1139,78 @@ void rc_reconfigurable::_rc_reset()
     }
 }
 
+void rc_reconfigurable::_rc_save_context()
+{
+    internals::phase_stopwatch sw(
+        p_phase_record, rc_phase_record::RESET_PHASE);
+    for (resettable_vector::const_iterator it =
+            p_resettable_vector.begin();
+        it != p_resettable_vector.end();
+        ++it)
+    {
+        (*it)->rc_on_save_context();
+    }
+    p_has_saved_context = true;
+}
+
+void rc_reconfigurable::_rc_restore_context()
+{
+    internals::phase_stopwatch sw(
+        p_phase_record, rc_phase_record::RESET_PHASE);
+    for (resettable_vector::const_iterator it =
+            p_resettable_vector.begin();
+        it != p_resettable_vector.end();
+        ++it)
+    {
+        (*it)->rc_on_restore_context();
+        // a restored context differs from the reset state
+        (*it)->rc_set_dirty();
+    }
+    p_has_saved_context = false;
+}
+
+void rc_reconfigurable::_rc_init_dirty_tracking(rc_resettable& resettable)
+{
+    // only the primary context tracks the modifications
+    if (resettable.p_reset_context == this
+    && resettable.rc_is_dirty_tracking())
+    {
+        resettable.p_is_dirty_tracked = true;
+        resettable.p_is_dirty = false;
+    } else {
+        p_untracked_resettable_vector.push_back(&resettable);
+    }
+}
+
+void rc_reconfigurable::_rc_preempt()
+{
+    ++p_preemption_count;
+
+    // discard the pending transactions (the completion of a tagged
+    //   transaction is recognised by its epoch)
+    if (p_tagged_transaction_count > 0) {
+        preemption_record& record = p_preemption_map[p_transaction_epoch];
+        record.time = sc_time_stamp();
+        record.pending_count = p_tagged_transaction_count;
+    }
+    ++p_transaction_epoch;
+    p_tagged_transaction_count = 0;
+    p_transaction_count = 0;
+    for (switch_commobj_index::iterator it =
+            p_switch_commobj_index.begin();
+        it != p_switch_commobj_index.end();
+        ++it)
+    {
+        it->first->abort_transactions();
+    }
+    // let the delta sync perform the deactivation
+    p_delta_sync.request_update();
+}
+
 rc_transaction::~rc_transaction()
 {
     if (!p_has_ended && reconf != NULL) {
-        reconf->rc_end_transaction();
+        reconf->rc_end_tagged_transaction(p_epoch);
     }
 }
 
@@ -849,6 +1279,14 @@ const rc_reconfigurable* rc_register_resettable(
     return reconf;
 }
 
+void rc_resettable::_rc_set_dirty()
+{
+    p_is_dirty = true;
+    if (p_is_dirty_tracked) {
+        p_reset_context->_rc_set_dirty(*this);
+    }
+}
+
 } // namespace ReChannel
 
 //
@@ -43,6 +43,9 @@
 
 #include "ReChannel/core/rc_common_header.h"
 #include "ReChannel/core/rc_switch.h"
+#include "ReChannel/core/rc_local_time.h"
+#include "ReChannel/core/rc_trace.h"
+#include "ReChannel/core/rc_phase_profile.h"
 #include "ReChannel/core/rc_resettable.h"
 #include "ReChannel/core/rc_process.h"
 #include "ReChannel/core/rc_reconfigurable_set.h"
@@ -224,6 +227,11 @@ class rc_reconfigurable
      */
     friend class rc_transaction_counter;
 
+    /**
+     * @brief Grant rc_resettable access to the dirty tracking.
+     */
+    friend class rc_resettable;
+
 public:
     /**
      * @brief Switch connector base type.
@@ -293,15 +301,31 @@ private:
     typedef std::map<rc_object_handle, filter_chain> commobj_filters_map;
 
     /**
-     * @brief The type of a set of resettable objects.
+     * @brief The type of a vector of resettable objects.
      */
-    typedef std::set<rc_resettable*>                 resettable_set;
+    typedef std::vector<rc_resettable*>              resettable_vector;
 
     /**
      * @brief The type of a set of resettable objects.
      */
     typedef std::vector<rc_portmap_base*>            portmap_vector;
 
+    /**
+     * @brief A preemption with discarded but still pending transactions.
+     */
+    struct preemption_record
+    {
+        /** @brief the time of the preemption */
+        sc_time time;
+        /** @brief the number of discarded transactions still pending */
+        int     pending_count;
+    };
+
+    /**
+     * @brief The type of the map: transaction epoch -> preemption record.
+     */
+    typedef std::map<unsigned int, preemption_record> preemption_map;
+
 public:
     /**
      * @brief The three possible reconfiguration states of a rc_reconfigurable.
@@ -429,6 +453,16 @@ public:
      */
     void rc_register_resettable(rc_resettable& resettable);
 
+    /**
+     * @brief Unregisters a resettable object.
+     *
+     * Has to be called before a registered resettable object is destroyed
+     * while its reconfigurable context still exists.
+     *
+     * \see rc_resettable
+     */
+    void rc_unregister_resettable(rc_resettable& resettable);
+
     /**
      * @brief Is the given resettable object registered?
      */
@@ -457,6 +491,25 @@ public:
      */
     inline void rc_end_transaction();
 
+    /**
+     * @brief Begin a transaction that is owned by its caller.
+     *
+     * Increases the internal transaction counter by one and returns the
+     * current transaction epoch, which has to be passed to
+     * rc_end_tagged_transaction(). A preemption advances the epoch, so
+     * that a discarded transaction cannot be mistaken for a live one
+     * when it completes.
+     *
+     * \see rc_set_preemption_deadline()
+     */
+    inline unsigned int rc_begin_tagged_transaction();
+
+    /**
+     * @brief Ends a transaction begun by rc_begin_tagged_transaction().
+     * @param epoch the epoch returned by rc_begin_tagged_transaction()
+     */
+    inline void rc_end_tagged_transaction(unsigned int epoch);
+
     /**
      * @brief Marks a point of possible deactivation for thread processes.
      *
@@ -516,6 +569,171 @@ public:
     inline sc_time rc_get_default_delay(action_type a) const
         { return p_action_default_delays[a]; }
 
+    /**
+     * @brief Enables preemptive deactivation with the given deadline.
+     *
+     * If the pending transactions did not finish within the deadline
+     * after a deactivation has been requested, they are discarded and the
+     * reconfigurable is deactivated immediately (preemption).
+     * In this case the registered resettables are not reset, but their
+     * context is saved and restored on the next activation.
+     *
+     * \see rc_resettable::rc_on_save_context(),
+     *      rc_resettable::rc_on_restore_context()
+     */
+    void rc_set_preemption_deadline(const sc_time& deadline);
+
+    /**
+     * @brief Disables preemptive deactivation.
+     */
+    void rc_clear_preemption_deadline();
+
+    /**
+     * @brief Is preemptive deactivation enabled?
+     */
+    inline bool rc_has_preemption_deadline() const
+        { return p_has_preemption_deadline; }
+
+    /**
+     * @brief Returns the preemption deadline.
+     */
+    inline sc_time rc_get_preemption_deadline() const
+        { return p_preemption_deadline; }
+
+    /**
+     * @brief Returns the number of preemptive deactivations.
+     */
+    inline unsigned int rc_get_preemption_count() const
+        { return p_preemption_count; }
+
+    /**
+     * @brief Returns the accumulated latency saved by preemption.
+     *
+     * The saved latency of a preemption is the time between the
+     * preemption and the completion of the last discarded transaction.
+     */
+    inline sc_time rc_get_preemption_latency_saved() const
+        { return p_preemption_latency_saved; }
+
+    /**
+     * @brief Returns the accumulated time spent in the given state.
+     *
+     * The time spent in the current state is included up to the current
+     * simulation time.
+     */
+    sc_time rc_get_state_time(state_type s) const;
+
+    /**
+     * @brief Returns the number of times the given action was performed.
+     */
+    inline unsigned int rc_get_action_count(action_type a) const
+        { return p_action_count[a]; }
+
+    /**
+     * @brief Returns the accumulated time spent waiting for the pending
+     *        transactions to drain on deactivation.
+     */
+    inline sc_time rc_get_drain_wait_time() const
+        { return p_drain_wait_time; }
+
+    /**
+     * @brief Returns the longest time spent waiting for the pending
+     *        transactions to drain on a single deactivation.
+     */
+    inline sc_time rc_get_max_drain_wait_time() const
+        { return p_max_drain_wait_time; }
+
+    /**
+     * @brief Returns the accumulated time the control spent waiting
+     *        for the lock on this reconfigurable.
+     *
+     * \see rc_control::lock()
+     */
+    inline sc_time rc_get_lock_wait_time() const
+        { return p_lock_wait_time; }
+
+    /**
+     * @brief Returns the longest time the control spent waiting for the
+     *        lock on this reconfigurable.
+     */
+    inline sc_time rc_get_max_lock_wait_time() const
+        { return p_max_lock_wait_time; }
+
+    /**
+     * @brief Resets the statistics of this reconfigurable.
+     *
+     * Resets the state times, the action counts, the drain and lock wait
+     * times, the preemption statistics and the phase profile.
+     */
+    void rc_reset_statistics();
+
+    /**
+     * @brief Returns the phase breakdown of the last reconfiguration.
+     *
+     * \see reconfigure(), rc_phase_record
+     */
+    inline const rc_phase_record& rc_get_last_phase_record() const
+        { return p_phase_record; }
+
+    /**
+     * @brief Returns the phase histograms of all reconfigurations.
+     *
+     * \see rc_phase_profile
+     */
+    inline const rc_phase_profile& rc_get_phase_profile() const
+        { return p_phase_profile; }
+
+    /**
+     * @brief Enables/disables the context-preserving mode.
+     *
+     * In context-preserving mode the registered resettables are not reset
+     * on deactivation and activation. Instead, their context is saved on
+     * deactivation and restored on the next activation. The resettables
+     * are only reset if the reconfigurable is unloaded.
+     *
+     * \see rc_resettable::rc_on_save_context(),
+     *      rc_resettable::rc_on_restore_context()
+     */
+    inline void rc_set_context_preserving(bool b)
+        { p_is_context_preserving = b; }
+
+    /**
+     * @brief Is the context-preserving mode enabled?
+     */
+    inline bool rc_is_context_preserving() const
+        { return p_is_context_preserving; }
+
+    /**
+     * @brief Enables/disables the temporally decoupled mode.
+     *
+     * In temporally decoupled mode the load and unload delays as well as
+     * the deactivation delay are added to the local time offset of the
+     * reconfiguring process instead of being waited for. The process
+     * synchronises with the kernel only if it reaches the next quantum
+     * boundary or if a handshake with the module's processes is needed,
+     * i.e. on activation and deactivation. The state changes take effect
+     * at the local time; the switches of an unloaded module are released
+     * as soon as the simulation time reaches it.
+     *
+     * \see rc_local_time
+     */
+    inline void rc_set_temporal_decoupling(bool b)
+        { p_is_temporally_decoupled = b; }
+
+    /**
+     * @brief Is the temporally decoupled mode enabled?
+     */
+    inline bool rc_is_temporally_decoupled() const
+        { return p_is_temporally_decoupled; }
+
+    /**
+     * @brief Has the context of the resettables been saved?
+     *
+     * If so, the context will be restored on the next activation.
+     */
+    inline bool rc_has_saved_context() const
+        { return p_has_saved_context; }
+
     /**
      * @brief Implicit cast to a set containing only this object.
      *
@@ -735,7 +953,11 @@ private:
      * @brief Obtain a lock on this reconfigurable (blocking).
      */
     inline void lock()
-        { p_mutex.lock(); }
+    {
+        RC_TRACE_BEGIN(this, this->rc_get_name(), LOCK_WAIT);
+        p_mutex.lock();
+        RC_TRACE_END(this, this->rc_get_name(), LOCK_WAIT);
+    }
 
     /**
      * @brief Obtain a lock on this reconfigurable (blocking, with timeout).
@@ -770,9 +992,13 @@ private:
 
     /**
      * @brief Lock all registered switches for this reconfigurable.
+     *
+     * The lock is shared, i.e. other reconfigurables may be loaded behind
+     * the same switches at the same time (shadow loading). An error is
+     * reported if a switch refuses the lock.
      * \remark Is called before a reconfigurable is loaded.
      */
-    bool lock_switches(bool report_error=false);
+    void lock_switches();
 
     /**
      * @brief Release the lock on all registered switches for this
@@ -781,6 +1007,24 @@ private:
      */
     void unlock_switches();
 
+    /**
+     * @brief Exclusively lock all registered switches for this
+     *        reconfigurable.
+     *
+     * Returns false (and releases the exclusive locks acquired so far)
+     * if any of the switches is exclusively locked by another
+     * reconfigurable.
+     * \remark Is called before a reconfigurable is activated.
+     */
+    bool lock_switches_exclusively(bool report_error=false);
+
+    /**
+     * @brief Release the exclusive lock on all registered switches for
+     * this reconfigurable.
+     * \remark Is called after a reconfigurable is deactivated.
+     */
+    void unlock_switches_exclusively();
+
     /**
      * @brief Set transaction count to zero.
      * \remark May only be used by ReChannel.
@@ -836,11 +1080,77 @@ private:
      */
     void _rc_deactivate();
 
+    /**
+     * @brief Waits or accumulates an action delay. (internal only)
+     */
+    void _rc_consume_delay(const sc_time& delay);
+
+    /**
+     * @brief Changes the state and accounts the time spent in the
+     *        previous state. (internal only)
+     *
+     * A temporally decoupled reconfiguration changes the state at its
+     * local time.
+     */
+    void _rc_set_state(state_type new_state);
+
+    /**
+     * @brief Releases the switch locks after the given delay, unless the
+     *        reconfigurable has been loaded again. (internal only)
+     */
+    void _rc_unlock_switches_at(const sc_time& delay);
+
+    /**
+     * @brief The method process of _rc_unlock_switches_at().
+     *        (internal only)
+     */
+    void _rc_unlock_proc();
+
+    /**
+     * @brief Accounts the time waited for the lock. (internal only)
+     */
+    void _rc_add_lock_wait_time(const sc_time& t, sc_dt::uint64 deltas);
+
     /**
      * @brief Resets all registered resettable objects. (internal only)
      */
     void _rc_reset();
 
+    /**
+     * @brief Saves the context of all registered resettable objects.
+     *        (internal only)
+     */
+    void _rc_save_context();
+
+    /**
+     * @brief Restores the context of all registered resettable objects.
+     *        (internal only)
+     */
+    void _rc_restore_context();
+
+    /**
+     * @brief Enables the dirty tracking of a resettable if it supports it.
+     *        (internal only)
+     */
+    void _rc_init_dirty_tracking(rc_resettable& resettable);
+
+    /**
+     * @brief Adds a modified resettable to the dirty vector.
+     *        (internal only)
+     */
+    inline void _rc_set_dirty(rc_resettable& resettable)
+        { p_dirty_resettable_vector.push_back(&resettable); }
+
+    /**
+     * @brief Discards the pending transactions. (internal only)
+     */
+    void _rc_preempt();
+
+    /**
+     * @brief Ends a transaction discarded by a preemption. (internal only)
+     */
+    void _rc_end_discarded_transaction(unsigned int epoch);
+
     /**
      * @brief Checks for compatibility with the given port map. (internal only)
      */
@@ -887,6 +1197,18 @@ private:
      * \note Is always greater than zero.
      */
     int                   p_transaction_count;
+    /**
+     * @brief The number of tagged transactions of the current epoch.
+     */
+    int                   p_tagged_transaction_count;
+    /**
+     * @brief The transaction epoch (advanced by every preemption).
+     */
+    unsigned int          p_transaction_epoch;
+    /**
+     * @brief The preemptions with pending discarded transactions.
+     */
+    preemption_map        p_preemption_map;
 
     /**
      * @brief The process control object.
@@ -917,7 +1239,33 @@ private:
     portmap_vector        p_portmap_vector;
     switch_conn_type*     p_curr_switch_conn;
 
-    resettable_set        p_resettable_set;
+    resettable_vector     p_resettable_vector;
+    resettable_vector     p_untracked_resettable_vector;
+    resettable_vector     p_dirty_resettable_vector;
+    bool                  p_is_resettable_init_done;
+
+    bool                  p_has_preemption_deadline;
+    sc_time               p_preemption_deadline;
+    bool                  p_has_saved_context;
+    bool                  p_is_context_preserving;
+    bool                  p_is_temporally_decoupled;
+    bool                  p_has_unlock_proc;
+    sc_event              p_unlock_event;
+    unsigned int          p_preemption_count;
+    sc_time               p_preemption_latency_saved;
+
+    sc_time               p_state_entry_time;
+    sc_time               p_state_time[STATE_COUNT];
+    unsigned int          p_action_count[ACTION_COUNT];
+    sc_time               p_drain_wait_time;
+    sc_time               p_max_drain_wait_time;
+    sc_time               p_lock_wait_time;
+    sc_time               p_max_lock_wait_time;
+
+    rc_phase_record       p_phase_record;
+    rc_phase_profile      p_phase_profile;
+    sc_time               p_pending_lock_time;
+    sc_dt::uint64         p_pending_lock_deltas;
 };
 
 /**
@@ -981,6 +1329,10 @@ private:
      * @brief The transaction ended flag.
      */
     bool p_has_ended;
+    /**
+     * @brief The transaction epoch of the begun transaction.
+     */
+    unsigned int p_epoch;
 };
 
 /* inline code */
@@ -994,11 +1346,28 @@ inline void rc_reconfigurable::rc_end_transaction()
     }
 }
 
+inline unsigned int rc_reconfigurable::rc_begin_tagged_transaction()
+{
+    ++p_transaction_count;
+    ++p_tagged_transaction_count;
+    return p_transaction_epoch;
+}
+
+inline void rc_reconfigurable::rc_end_tagged_transaction(unsigned int epoch)
+{
+    if (epoch == p_transaction_epoch) {
+        --p_tagged_transaction_count;
+        this->rc_end_transaction();
+    } else {
+        this->_rc_end_discarded_transaction(epoch);
+    }
+}
+
 inline rc_transaction::rc_transaction(rc_reconfigurable* reconf)
-    : reconf(reconf), p_has_ended(false)
+    : reconf(reconf), p_has_ended(false), p_epoch(0)
 {
     if (reconf != NULL) {
-        reconf->rc_begin_transaction();
+        p_epoch = reconf->rc_begin_tagged_transaction();
     }
     // p_has_ended must initially be set to false (see RC_TRANSACTION)
 }
@@ -1006,7 +1375,7 @@ inline rc_transaction::rc_transaction(rc_reconfigurable* reconf)
 inline void rc_transaction::begin()
 {
     if (p_has_ended && reconf != NULL) {
-        reconf->rc_begin_transaction();
+        p_epoch = reconf->rc_begin_tagged_transaction();
     }
     // this must always be set, to allow RC_TRANSACTION to work properly
     p_has_ended = false;
@@ -1015,7 +1384,7 @@ inline void rc_transaction::begin()
 inline void rc_transaction::end()
 {
     if (!p_has_ended && reconf != NULL) {
-        reconf->rc_end_transaction();
+        reconf->rc_end_tagged_transaction(p_epoch);
         reconf->rc_possible_deactivation();
     }
     // this must always be set, to allow RC_TRANSACTION to work properly
@@ -0,0 +1,414 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_reconfigurable_placeholder.h
+ * @brief   Classes rc_placeholder_body and rc_reconfigurable_placeholder.
+ */
+
+#ifndef RC_RECONFIGURABLE_PLACEHOLDER_H_
+#define RC_RECONFIGURABLE_PLACEHOLDER_H_
+
+#include "ReChannel/core/rc_reconfigurable_module.h"
+#include "ReChannel/core/rc_process_support.h"
+
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+
+namespace ReChannel {
+
+template<class Body, class Module>
+class rc_reconfigurable_placeholder;
+
+/**
+ * @brief Base class of the body of a placeholder.
+ *
+ * The body contains the actual behaviour of an
+ * rc_reconfigurable_placeholder. It is constructed not before the
+ * placeholder is loaded for the first time.
+ *
+ * Since SystemC does not permit the creation of modules, ports and
+ * primitive channels during simulation, a body is a plain C++ object.
+ * It communicates through the ports of the placeholder and creates its
+ * processes by calling rc_reconfigurable_placeholder::rc_spawn() from
+ * within rc_on_activate(). These processes are terminated on
+ * deactivation.
+ *
+ * If the body additionally implements rc_resettable it is registered
+ * with the placeholder for the lifetime of the body. Since the body is
+ * created during simulation, rc_resettable::rc_on_init_resettable() is not
+ * called; reset values have to be initialised by the body's constructor.
+ *
+ * \see rc_reconfigurable_placeholder
+ */
+class rc_placeholder_body
+{
+    template<class Body, class Module>
+    friend class rc_reconfigurable_placeholder;
+
+public:
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~rc_placeholder_body() {}
+
+protected:
+    /**
+     * @brief Called after the placeholder has been loaded.
+     * \note May contain waits.
+     */
+    virtual void rc_on_load() {}
+
+    /**
+     * @brief Called after the placeholder has been activated.
+     *
+     * The processes of the body have to be (re-)spawned here.
+     *
+     * \note May contain waits.
+     */
+    virtual void rc_on_activate() {}
+
+    /**
+     * @brief Called after the placeholder has been deactivated.
+     * \note May contain waits.
+     */
+    virtual void rc_on_deactivate() {}
+
+    /**
+     * @brief Called after the placeholder has been unloaded.
+     * \note May contain waits.
+     */
+    virtual void rc_on_unload() {}
+};
+
+/**
+ * @brief Class of a reconfigurable placeholder module.
+ *
+ * A placeholder is a reconfigurable module that only declares the ports
+ * and port maps of an alternative implementation. The actual behaviour
+ * (the body) is created by a factory function on the first load and,
+ * optionally, destroyed on unload. Thus alternatives that are loaded
+ * rarely or never do not occupy memory or elaboration time for their
+ * processes and internal objects.
+ *
+ * The ports have to be declared by Module (or by a class derived from the
+ * placeholder) and the port maps are added with rc_add_portmap(),
+ * exactly like for an ordinary rc_reconfigurable_module. A placeholder
+ * can therefore be bound with the same rc_switch_connector as any other
+ * compatible module.
+ *
+ * Example:
+ * \code
+ * SC_MODULE(filter_ports) {
+ *     sc_in<int> in; sc_out<int> out;
+ *     SC_CTOR(filter_ports) : in("in"), out("out") {}
+ * };
+ * class filter_body;
+ * typedef rc_reconfigurable_placeholder<filter_body, filter_ports>
+ *     filter_placeholder;
+ *
+ * class filter_body : public rc_placeholder_body {
+ * public:
+ *     filter_body(filter_placeholder& p) : p(p) {}
+ * protected:
+ *     RC_ON_ACTIVATE() { p.rc_spawn(boost::bind(&filter_body::proc, this)); }
+ *     void proc() { while(true) { p.out.write(p.in.read()); } }
+ *     filter_placeholder& p;
+ * };
+ *
+ * // the port map is added exactly like for an ordinary module
+ * class filter : public filter_placeholder {
+ * public:
+ *     filter(sc_module_name n) : filter_placeholder(n, true)
+ *         { rc_add_portmap(my_portmap(in, out)); }
+ * };
+ * \endcode
+ *
+ * \note If the placeholder is loaded during elaboration, the body is
+ * constructed (and activated) at the beginning of the simulation. In
+ * this case the callbacks of the body must not contain waits.
+ *
+ * \remark If a derived class overrides one of the rc_on_*() callbacks it
+ * has to call the respective method of this class.
+ *
+ * \see rc_placeholder_body, rc_reconfigurable_module, rc_portmap
+ */
+template<class Body, class Module=sc_module>
+class rc_reconfigurable_placeholder
+    : public rc_reconfigurable_module<Module>
+{
+    /**
+     * @brief Static assertion to check if Body is a valid body type.
+     */
+    RC_STATIC_ASSERT_T(
+        body_type_check,
+        (boost::is_base_of<rc_placeholder_body, Body>::value));
+
+private:
+    typedef rc_reconfigurable_placeholder<Body, Module> this_type;
+    typedef rc_reconfigurable_module<Module>            base_type;
+
+public:
+    /**
+     * @brief The type of the body.
+     */
+    typedef Body body_type;
+
+    /**
+     * @brief The type of the factory function.
+     */
+    typedef boost::function<body_type* (this_type&)> factory_type;
+
+public:
+    /**
+     * @brief Constructor using the default factory.
+     *
+     * The default factory creates the body by calling
+     * Body::Body(rc_reconfigurable_placeholder<Body, Module>&).
+     */
+    explicit rc_reconfigurable_placeholder(
+        sc_module_name module_name, bool destroy_on_unload=false);
+
+    /**
+     * @brief Constructor using a user-defined factory.
+     */
+    rc_reconfigurable_placeholder(
+        sc_module_name module_name, const factory_type& factory,
+        bool destroy_on_unload=false);
+
+    /**
+     * @brief Sets the factory used for the construction of the body.
+     */
+    inline void rc_set_factory(const factory_type& factory)
+        { p_factory = factory; }
+
+    /**
+     * @brief Has the body been constructed?
+     */
+    inline bool rc_has_body() const
+        { return (p_body != NULL); }
+
+    /**
+     * @brief Returns the body (or NULL if it does not exist).
+     */
+    inline body_type* rc_get_body() const
+        { return p_body; }
+
+    /**
+     * @brief Shall the body be destroyed on unload?
+     */
+    inline void rc_set_destroy_on_unload(bool b)
+        { p_destroy_on_unload = b; }
+
+    /**
+     * @brief Is the body destroyed on unload?
+     */
+    inline bool rc_is_destroy_on_unload() const
+        { return p_destroy_on_unload; }
+
+    /**
+     * @brief Returns how often the body has been constructed.
+     */
+    inline unsigned int rc_get_body_construction_count() const
+        { return p_construction_count; }
+
+    /**
+     * @brief Spawns a reconfigurable process on behalf of the body.
+     */
+    inline rc_process_handle rc_spawn(
+        boost::function<void (void)> func, const char* name_p=NULL,
+        rc_spawn_options* opt_p=NULL)
+        { return p_process_support.rc_spawn(func, name_p, opt_p); }
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~rc_reconfigurable_placeholder();
+
+protected:
+
+    virtual void rc_on_load();
+
+    virtual void rc_on_activate();
+
+    virtual void rc_on_deactivate();
+
+    virtual void rc_on_unload();
+
+    virtual void start_of_simulation();
+
+private:
+    void _rc_construct_body();
+
+    void _rc_destroy_body();
+
+    void _rc_elaboration_load_proc();
+
+    static body_type* _rc_default_factory(this_type& placeholder)
+        { return new body_type(placeholder); }
+
+private:
+    factory_type                p_factory;
+    body_type*                  p_body;
+    bool                        p_destroy_on_unload;
+    unsigned int                p_construction_count;
+    internals::process_support  p_process_support;
+
+private:
+    // disabled
+    rc_reconfigurable_placeholder(const this_type& other);
+    this_type& operator=(const this_type& other);
+};
+
+/* template code */
+
+template<class Body, class Module>
+rc_reconfigurable_placeholder<Body, Module>::rc_reconfigurable_placeholder(
+    sc_module_name module_name, bool destroy_on_unload)
+    : base_type(module_name),
+      p_factory(&this_type::_rc_default_factory), p_body(NULL),
+      p_destroy_on_unload(destroy_on_unload), p_construction_count(0)
+{ }
+
+template<class Body, class Module>
+rc_reconfigurable_placeholder<Body, Module>::rc_reconfigurable_placeholder(
+    sc_module_name module_name, const factory_type& factory,
+    bool destroy_on_unload)
+    : base_type(module_name),
+      p_factory(factory), p_body(NULL),
+      p_destroy_on_unload(destroy_on_unload), p_construction_count(0)
+{ }
+
+template<class Body, class Module>
+rc_reconfigurable_placeholder<Body, Module>::~rc_reconfigurable_placeholder()
+{
+    this->_rc_destroy_body();
+}
+
+template<class Body, class Module>
+void rc_reconfigurable_placeholder<Body, Module>::rc_on_load()
+{
+    this->_rc_construct_body();
+    static_cast<rc_placeholder_body*>(p_body)->rc_on_load();
+}
+
+template<class Body, class Module>
+void rc_reconfigurable_placeholder<Body, Module>::rc_on_activate()
+{
+    if (p_body != NULL) {
+        static_cast<rc_placeholder_body*>(p_body)->rc_on_activate();
+    }
+}
+
+template<class Body, class Module>
+void rc_reconfigurable_placeholder<Body, Module>::rc_on_deactivate()
+{
+    if (p_body != NULL) {
+        static_cast<rc_placeholder_body*>(p_body)->rc_on_deactivate();
+    }
+}
+
+template<class Body, class Module>
+void rc_reconfigurable_placeholder<Body, Module>::rc_on_unload()
+{
+    if (p_body != NULL) {
+        static_cast<rc_placeholder_body*>(p_body)->rc_on_unload();
+        if (p_destroy_on_unload) {
+            this->_rc_destroy_body();
+        }
+    }
+}
+
+template<class Body, class Module>
+void rc_reconfigurable_placeholder<Body, Module>::start_of_simulation()
+{
+    Module::start_of_simulation();
+
+    // loaded during elaboration?
+    if (this->rc_is_loaded()) {
+        // the body is constructed as soon as the simulation is running
+        sc_spawn_options opt;
+        opt.spawn_method();
+        sc_spawn(
+            boost::bind(&this_type::_rc_elaboration_load_proc, this),
+            sc_gen_unique_name("_rc_elaboration_load_proc"), &opt);
+    }
+}
+
+template<class Body, class Module>
+void rc_reconfigurable_placeholder<Body, Module>::_rc_construct_body()
+{
+    if (p_body != NULL) {
+        return;
+    }
+    if (p_factory.empty()) {
+        RC_REPORT_ERROR(RC_ID_NULL_POINTER_,
+            "no body factory specified"
+            " (in reconfigurable '" << this->rc_get_name() << "')");
+    }
+    p_body = p_factory(*this);
+    if (p_body == NULL) {
+        RC_REPORT_ERROR(RC_ID_NULL_POINTER_,
+            "body factory did not create a body"
+            " (in reconfigurable '" << this->rc_get_name() << "')");
+    }
+    ++p_construction_count;
+    rc_resettable* const resettable = dynamic_cast<rc_resettable*>(p_body);
+    if (resettable != NULL) {
+        this->rc_register_resettable(*resettable);
+    }
+}
+
+template<class Body, class Module>
+void rc_reconfigurable_placeholder<Body, Module>::_rc_destroy_body()
+{
+    if (p_body == NULL) {
+        return;
+    }
+    rc_resettable* const resettable = dynamic_cast<rc_resettable*>(p_body);
+    if (resettable != NULL) {
+        this->rc_unregister_resettable(*resettable);
+    }
+    delete p_body;
+    p_body = NULL;
+}
+
+template<class Body, class Module>
+void rc_reconfigurable_placeholder<Body, Module>::_rc_elaboration_load_proc()
+{
+    if (p_body == NULL && this->rc_is_loaded()) {
+        this->_rc_construct_body();
+        static_cast<rc_placeholder_body*>(p_body)->rc_on_load();
+        if (this->rc_is_active()) {
+            static_cast<rc_placeholder_body*>(p_body)->rc_on_activate();
+        }
+    }
+}
+
+} // namespace ReChannel
+
+#endif // RC_RECONFIGURABLE_PLACEHOLDER_H_
+
+//
+// $Id$
+//
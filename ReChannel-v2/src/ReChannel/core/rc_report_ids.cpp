@@ -74,6 +74,9 @@ const char RC_ID_SWITCH_CONNECTOR_BINDING_ERROR_[]
 const char RC_ID_SWITCH_CONNECTOR_INCOMPATIBLE_ERROR_[]
     = RC_REPORT_MSG_TYPE "/switch_connector/incompatible_error";
 
+const char RC_ID_TRACE_FILE_ERROR_[]
+    = RC_REPORT_MSG_TYPE "/trace/file_error";
+
 } // namespace ReChannel
 
 //
@@ -65,6 +65,8 @@ extern const char RC_ID_SWITCH_CONNECTOR_BINDING_ERROR_[];
 
 extern const char RC_ID_SWITCH_CONNECTOR_INCOMPATIBLE_ERROR_[];
 
+extern const char RC_ID_TRACE_FILE_ERROR_[];
+
 } // namespace ReChannel
 
 #endif // RC_CORE_REPORT_IDS_H_
@@ -90,6 +90,48 @@ void reset_buffer::update()
     }
 }
 
+reset_monitor::reset_monitor(const sc_signal_in_if<bool>& source)
+    : p_source(source), p_last_level(false)
+{
+    sc_spawn_options opt;
+    {
+        opt.spawn_method();
+        opt.set_sensitivity(&source.value_changed_event());
+    }
+    sc_spawn(
+        sc_bind(&reset_monitor::_rc_monitor_proc, this),
+        sc_gen_unique_name("_rc_reset_monitor_proc"), &opt);
+}
+
+void reset_monitor::register_process_control(
+    rc_process_control& pctrl, bool active_level) const
+{
+    p_pctrl_set[(active_level ? 1 : 0)].insert(&pctrl);
+}
+
+void reset_monitor::unregister_process_control(
+    rc_process_control& pctrl) const
+{
+    p_pctrl_set[0].erase(&pctrl);
+    p_pctrl_set[1].erase(&pctrl);
+}
+
+void reset_monitor::_rc_monitor_proc()
+{
+    // (the initial run only reacts to an initially set source)
+    const bool level = p_source.read();
+    if (level != p_last_level) {
+        p_last_level = level;
+        pctrl_set& set_ = p_pctrl_set[(level ? 1 : 0)];
+        for (pctrl_set::iterator it = set_.begin();
+            it != set_.end();
+            ++it)
+        {
+            (*it)->deactivate();
+        }
+    }
+}
+
 } // namespace internals
 
 } // namespace ReChannel
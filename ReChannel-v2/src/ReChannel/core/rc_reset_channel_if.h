@@ -212,6 +212,58 @@ private:
     mutable pctrl_set p_pctrl_set[2];
 };
 
+/**
+ * @brief Turns an arbitrary boolean signal into a reset channel
+ *        (used internally).
+ *
+ * In contrast to reset_signal, the monitor does not mirror the value of
+ * its source signal. A method process that is sensitive to the source's
+ * value_changed_event() deactivates the registered process controls
+ * directly. Hence, a reset takes effect in the delta cycle its edge is
+ * observed and no additional signal has to be updated.
+ *
+ * \remarks The monitor is never deleted, since its method process
+ * refers to it for the rest of the simulation.
+ */
+class reset_monitor
+    : virtual public rc_reset_channel_if
+{
+private:
+    typedef std::set<rc_process_control*> pctrl_set;
+
+public:
+    explicit reset_monitor(const sc_signal_in_if<bool>& source);
+
+    virtual void register_process_control(
+        rc_process_control& pctrl, bool active_level) const;
+
+    virtual void unregister_process_control(
+        rc_process_control& pctrl) const;
+
+    virtual bool get_current_level() const
+        { return p_source.read(); }
+
+    // returns the source if it is a SystemC signal
+    virtual const sc_signal<bool>* get_underlying_reset_signal() const
+        { return dynamic_cast<const sc_signal<bool>*>(&p_source); }
+
+    inline const sc_signal_in_if<bool>& get_source() const
+        { return p_source; }
+
+private:
+    void _rc_monitor_proc();
+
+private:
+    const sc_signal_in_if<bool>& p_source;
+    bool                         p_last_level;
+    mutable pctrl_set            p_pctrl_set[2];
+
+private:
+    // disabled
+    reset_monitor(const reset_monitor& orig);
+    reset_monitor& operator=(const reset_monitor& orig);
+};
+
 } // namespace internals
 
 } // namespace ReChannel
@@ -64,6 +64,21 @@ class rc_reconfigurable;
  * rc_reconfigurable is activated or deactivated during simulation phase, i.e.
  * normally it will be called twice. An implementation is free to only reset
  * itself either at activation or deactivation if this is possible (and safe).
+ *
+ * A resettable may support <em>dirty tracking</em> by overriding
+ * rc_is_dirty_tracking() and calling rc_set_dirty() whenever its state is
+ * modified. In this case rc_on_reset() is only called if the object has
+ * been modified since the last reset. Otherwise rc_on_reset() is called on
+ * every activation and deactivation.
+ *
+ * If the context of a reconfigurable shall be preserved (e.g. after a
+ * preemptive deactivation or if rc_reconfigurable::rc_set_context_preserving()
+ * has been enabled) rc_on_save_context() is called instead of
+ * rc_on_reset() on deactivation, and rc_on_restore_context() is called
+ * instead of rc_on_reset() on the next activation. By default, both methods
+ * do nothing, i.e. the component simply keeps its current state. A saved
+ * context is discarded (by calling rc_on_reset()) when the reconfigurable
+ * is unloaded.
  * 
  * \see \ref sec_reset_comp, rc_reconfigurable, rc_register_resettable(),
  *      rc_get_reconfigurable_context()
@@ -76,6 +91,13 @@ class rc_resettable
     friend class rc_reconfigurable;
 
 protected:
+    /**
+     * @brief Constructor.
+     */
+    rc_resettable()
+        : p_reset_context(NULL), p_is_dirty_tracked(false), p_is_dirty(true)
+        { }
+
 	/**
 	 * @brief Called to request the object for an immediate reset.
 	 * 
@@ -103,10 +125,70 @@ protected:
 	 */
     virtual void rc_on_init_resettable() = 0;
 
+    /**
+     * @brief Called when the object shall save its current state.
+     *
+     * rc_on_save_context() is called instead of rc_on_reset() if a
+     * rc_reconfigurable is deactivated and its context shall be preserved
+     * until the next activation.
+     *
+     * \remark An implementation of this method shall not invoke any wait
+     *         statements.
+     */
+    virtual void rc_on_save_context() {}
+
+    /**
+     * @brief Called when the object shall restore its saved state.
+     *
+     * rc_on_restore_context() is called instead of rc_on_reset() if a
+     * rc_reconfigurable is activated and a previously saved context
+     * exists.
+     *
+     * \remark An implementation of this method shall not invoke any wait
+     *         statements.
+     */
+    virtual void rc_on_restore_context() {}
+
+    /**
+     * @brief Does the object support dirty tracking?
+     *
+     * An object that returns true is obliged to call rc_set_dirty() on
+     * every modification of its state. The method is queried once after
+     * rc_on_init_resettable() has been called.
+     */
+    virtual bool rc_is_dirty_tracking() const
+        { return false; }
+
+    /**
+     * @brief Marks the object as modified since the last reset.
+     */
+    inline void rc_set_dirty()
+    {
+        if (!p_is_dirty) {
+            this->_rc_set_dirty();
+        }
+    }
+
+    /**
+     * @brief Has the object been modified since the last reset?
+     *
+     * \remark Always returns true if the object is not dirty tracked.
+     */
+    inline bool rc_is_dirty() const
+        { return p_is_dirty; }
+
     /**
 	 * @brief Virtual destructor.
 	 */
 	virtual ~rc_resettable() {}
+
+private:
+    void _rc_set_dirty();
+
+private:
+    rc_reconfigurable* p_reset_context;
+    bool               p_is_dirty_tracked;
+    bool               p_is_dirty;
 };
 
 } // namespace ReChannel
@@ -149,6 +231,22 @@ protected:
 #define RC_ON_INIT_RESETTABLE() \
     virtual void rc_on_init_resettable()
 
+/**
+ * @brief Declares the rc_on_save_context() callback method.
+ *
+ * \see rc_resettable, RC_ON_RESTORE_CONTEXT()
+ */
+#define RC_ON_SAVE_CONTEXT() \
+    virtual void rc_on_save_context()
+
+/**
+ * @brief Declares the rc_on_restore_context() callback method.
+ *
+ * \see rc_resettable, RC_ON_SAVE_CONTEXT()
+ */
+#define RC_ON_RESTORE_CONTEXT() \
+    virtual void rc_on_restore_context()
+
 #endif // RC_RESETTABLE_H_
 
 //
@@ -79,9 +79,12 @@ class rc_interface_filter;
  * time. The reconfigurable modules that represent the dynamic side have to be
  * registered with the switch.
  *
- * Among all registered reconfigurable module at most one shall be loaded.
- * A switch shall enforce the rule that only one reconfigurable can be loaded
- * at a time. In case of a conflict an error shall be reported.
+ * Any number of the registered reconfigurable modules may be loaded at the
+ * same time (shadow loading), but at most one of them shall be active.
+ * A loaded module holds a shared lock on the switch, whereas an active module
+ * additionally holds the exclusive lock. A switch shall enforce the rule that
+ * only one reconfigurable can hold the exclusive lock at a time. In case of a
+ * conflict an error shall be reported.
  *
  * <b>Control</b>
  *
@@ -177,6 +180,16 @@ public:
      */
     virtual unsigned int get_transaction_count() const = 0;
 
+    /**
+     * @brief The total number of transactions begun at this switch.
+     *
+     * Counts all transactions since the start of the simulation,
+     * irrespectively of the reconfigurable module they belong to.
+     * Switches that do not count their transactions return 0.
+     */
+    virtual unsigned long get_total_transaction_count() const
+        { return 0; }
+
     /**
      * @brief Returns the static side's communication interface.
      *
@@ -209,6 +222,18 @@ public:
      */
     virtual bool is_locked() const = 0;
 
+    /**
+     * @brief Is the switch exclusively locked by an active rc_reconfigurable?
+     *
+     * By default, the (shared) lock is regarded as exclusive, i.e. a
+     * switch that does not implement the exclusive lock can only be
+     * locked by a single rc_reconfigurable (no shadow loading).
+     *
+     * \note Locking is used to detect reconfiguration conflicts.
+     */
+    virtual bool is_exclusively_locked() const
+        { return this->is_locked(); }
+
     /**
      * @brief Is the given rc_reconfigurable registered with this switch?
      */
@@ -272,6 +297,18 @@ protected:
      */
     virtual void set_undefined() = 0;
 
+    /**
+     * @brief Discards the pending transactions of the current
+     *        reconfigurable.
+     *
+     * Is used to preempt a reconfigurable that did not finish its
+     * transactions in time. Afterwards, the switch may be closed
+     * immediately. Transactions that complete after they have been
+     * discarded shall be accounted to the preempted reconfigurable.
+     * By default, nothing is discarded.
+     */
+    virtual void abort_transactions() { }
+
     /**
      * @brief Request a refresh of the event notifications.
      */
@@ -312,12 +349,40 @@ protected:
     virtual bool is_lock_owner(const rc_reconfigurable& reconf) const = 0;
 
     /**
-     * @brief Sets/unsets the lock owner.
+     * @brief Adds/removes a (shared) lock owner.
+     *
+     * Removing a lock owner also releases its exclusive lock.
      *
      * \note Locking is used to detect reconfiguration conflicts.
      */
     virtual bool set_locked(rc_reconfigurable& lock_owner, bool lock) = 0;
 
+    /**
+     * @brief Has the switch been exclusively locked by the given
+     *        rc_reconfigurable?
+     *
+     * By default, the (shared) lock owner is the exclusive lock owner.
+     *
+     * \note Locking is used to detect reconfiguration conflicts.
+     */
+    virtual bool is_exclusive_lock_owner(
+        const rc_reconfigurable& reconf) const
+        { return this->is_lock_owner(reconf); }
+
+    /**
+     * @brief Sets/unsets the exclusive lock owner.
+     *
+     * Only a (shared) lock owner may acquire the exclusive lock.
+     * Returns false if the exclusive lock is held by another
+     * rc_reconfigurable. By default, the (shared) lock owner already
+     * holds the lock exclusively.
+     *
+     * \note Locking is used to detect reconfiguration conflicts.
+     */
+    virtual bool set_exclusively_locked(
+        rc_reconfigurable& lock_owner, bool lock)
+        { return (!lock || this->is_lock_owner(lock_owner)); }
+
     /**
      * @brief Virtual destructor.
      */
@@ -0,0 +1,156 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_trace.cpp
+ * @brief   Class rc_trace (the trace recorder)
+ */
+
+#include "rc_trace.h"
+
+#ifdef RC_ENABLE_TRACE
+
+#include <sys/time.h>
+
+namespace ReChannel {
+
+rc_trace::rc_trace()
+    : p_buffer(RC_TRACE_BUFFER_SIZE), p_count(0),
+      p_last_obj(NULL), p_last_id(0),
+      p_file_name(RC_TRACE_FILE_NAME), p_is_open(false)
+{
+    p_wall_time_base = _rc_get_wall_time();
+}
+
+rc_trace::~rc_trace()
+{
+    this->_rc_flush();
+}
+
+void rc_trace::set_file_name(const std::string& file_name)
+{
+    rc_trace& trace = _rc_get_instance();
+    if (trace.p_is_open) {
+        RC_REPORT_WARNING(RC_ID_TRACE_FILE_ERROR_,
+            "trace file '" << trace.p_file_name << "' is already open,"
+            " '" << file_name << "' is ignored");
+        return;
+    }
+    trace.p_file_name = file_name;
+}
+
+unsigned int rc_trace::register_object(
+    const void* obj, const std::string& name)
+{
+    rc_trace& trace = _rc_get_instance();
+    // ids start with 1 (0 denotes an unknown object)
+    const unsigned int id = trace.p_object_map.size() + 1;
+    trace.p_object_map[obj] = id;
+    trace.p_new_objects.push_back(object_decl(id, name));
+    return id;
+}
+
+void rc_trace::record(
+    unsigned int object_id, action_type action, phase_type phase)
+{
+    rc_trace& trace = _rc_get_instance();
+    if (trace.p_count == trace.p_buffer.size()) {
+        trace._rc_flush();
+    }
+    record_type& rec = trace.p_buffer[trace.p_count++];
+    rec.object_id = object_id;
+    rec.action = (boost::uint16_t)action;
+    rec.phase = (boost::uint16_t)phase;
+    rec.sim_time = sc_time_stamp().value();
+    rec.delta_count = sc_delta_count();
+    rec.wall_time = _rc_get_wall_time() - trace.p_wall_time_base;
+}
+
+void rc_trace::flush()
+{
+    _rc_get_instance()._rc_flush();
+}
+
+void rc_trace::_rc_flush()
+{
+    if (p_count == 0 && p_new_objects.empty()) {
+        return;
+    }
+    if (!p_is_open) {
+        p_file.open(p_file_name.c_str(),
+            std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!p_file) {
+            RC_REPORT_WARNING(RC_ID_TRACE_FILE_ERROR_,
+                "trace file '" << p_file_name << "' cannot be opened,"
+                " " << p_count << " trace records are lost");
+            p_count = 0;
+            p_new_objects.clear();
+            return;
+        }
+        p_is_open = true;
+        trace_format::header header;
+        std::copy(trace_format::magic, trace_format::magic + 8,
+            header.magic);
+        header.time_resolution = sc_get_time_resolution().to_seconds();
+        p_file.write((const char*)&header, sizeof(header));
+    }
+    // the objects have to be declared before they are referred to
+    for (object_decl_vector::const_iterator it = p_new_objects.begin();
+        it != p_new_objects.end();
+        ++it)
+    {
+        const char kind = trace_format::CHUNK_OBJECT;
+        const boost::uint32_t id = it->first;
+        const boost::uint32_t length = it->second.size();
+        p_file.write(&kind, 1);
+        p_file.write((const char*)&id, sizeof(id));
+        p_file.write((const char*)&length, sizeof(length));
+        p_file.write(it->second.data(), length);
+    }
+    p_new_objects.clear();
+    if (p_count > 0) {
+        const char kind = trace_format::CHUNK_RECORDS;
+        const boost::uint32_t count = p_count;
+        p_file.write(&kind, 1);
+        p_file.write((const char*)&count, sizeof(count));
+        p_file.write(
+            (const char*)&p_buffer[0], p_count * sizeof(record_type));
+        p_count = 0;
+    }
+    p_file.flush();
+}
+
+boost::uint64_t rc_trace::_rc_get_wall_time()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (boost::uint64_t)tv.tv_sec * 1000000000u
+        + (boost::uint64_t)tv.tv_usec * 1000u;
+}
+
+} // namespace ReChannel
+
+#endif // RC_ENABLE_TRACE
+
+//
+// $Id$
+//
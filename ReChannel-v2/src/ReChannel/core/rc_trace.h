@@ -0,0 +1,198 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_trace.h
+ * @brief   Class rc_trace (the trace recorder)
+ *
+ * The trace recorder is only compiled if RC_ENABLE_TRACE is defined. The
+ * library and the application must be compiled with the same setting.
+ * Otherwise the trace macros expand to nothing.
+ */
+
+#ifndef RC_TRACE_H_
+#define RC_TRACE_H_
+
+#ifndef RC_TRACE_BUFFER_SIZE
+/**
+ * @brief The number of records buffered before they are written.
+ */
+#define RC_TRACE_BUFFER_SIZE 4096
+#endif // RC_TRACE_BUFFER_SIZE
+
+#ifndef RC_TRACE_FILE_NAME
+/**
+ * @brief The default name of the trace file.
+ */
+#define RC_TRACE_FILE_NAME "rechannel.rctrace"
+#endif // RC_TRACE_FILE_NAME
+
+#ifdef RC_ENABLE_TRACE
+
+#include <fstream>
+
+#include "ReChannel/core/rc_common_header.h"
+#include "ReChannel/core/rc_trace_format.h"
+
+namespace ReChannel {
+
+/**
+ * @brief Class rc_trace
+ *
+ * rc_trace records the reconfiguration events in a compact binary
+ * format. Each record holds the object id, the action, the phase, the
+ * simulation time, the delta count and the wall-clock time.
+ *
+ * The records are collected in a fixed-size buffer, which is written to
+ * the trace file whenever it is full and at the end of the program.
+ * tools/rc_trace2json converts a trace file to the Chrome/Perfetto
+ * trace format.
+ *
+ * \remark Use the RC_TRACE_* macros instead of calling rc_trace
+ *         directly. They expand to nothing if RC_ENABLE_TRACE is not
+ *         defined.
+ */
+class rc_trace
+{
+private:
+    typedef std::map<const void*, unsigned int>  object_map;
+    typedef std::pair<unsigned int, std::string> object_decl;
+    typedef std::vector<object_decl>             object_decl_vector;
+
+public:
+    typedef trace_format::record record_type;
+    typedef trace_format::action action_type;
+    typedef trace_format::phase  phase_type;
+
+public:
+    /** @brief sets the name of the trace file (before the first flush) */
+    static void set_file_name(const std::string& file_name);
+
+    /** @brief returns the id of the object (0 if not registered) */
+    static inline unsigned int get_object_id(const void* obj);
+
+    /** @brief registers an object and returns its id */
+    static unsigned int register_object(
+        const void* obj, const std::string& name);
+
+    /** @brief appends a record to the buffer */
+    static void record(
+        unsigned int object_id, action_type action, phase_type phase);
+
+    /** @brief writes the buffered records to the trace file */
+    static void flush();
+
+private:
+    rc_trace();
+
+    ~rc_trace();
+
+    static inline rc_trace& _rc_get_instance();
+
+    void _rc_flush();
+
+    static boost::uint64_t _rc_get_wall_time();
+
+private:
+    std::vector<record_type> p_buffer;
+    unsigned int             p_count;
+    object_map               p_object_map;
+    object_decl_vector       p_new_objects;
+    const void*              p_last_obj;
+    unsigned int             p_last_id;
+    std::string              p_file_name;
+    std::ofstream            p_file;
+    bool                     p_is_open;
+    boost::uint64_t          p_wall_time_base;
+
+private:
+    // disabled
+    rc_trace(const rc_trace& orig);
+    rc_trace& operator=(const rc_trace& orig);
+};
+
+/* inline code */
+
+inline rc_trace& rc_trace::_rc_get_instance()
+{
+    // the instance is flushed on destruction at the end of the program
+    static rc_trace s_instance;
+    return s_instance;
+}
+
+inline unsigned int rc_trace::get_object_id(const void* obj)
+{
+    rc_trace& trace = _rc_get_instance();
+    if (obj != trace.p_last_obj) {
+        object_map::const_iterator it = trace.p_object_map.find(obj);
+        if (it == trace.p_object_map.end()) {
+            return 0;
+        }
+        trace.p_last_obj = obj;
+        trace.p_last_id = it->second;
+    }
+    return trace.p_last_id;
+}
+
+} // namespace ReChannel
+
+#define _RC_TRACE_RECORD(obj_, name_, action_, phase_) \
+    if (true) { \
+        unsigned int _rc_trace_id = \
+            ::ReChannel::rc_trace::get_object_id(obj_); \
+        if (_rc_trace_id == 0) { \
+            _rc_trace_id = \
+                ::ReChannel::rc_trace::register_object(obj_, name_); \
+        } \
+        ::ReChannel::rc_trace::record(_rc_trace_id, \
+            ::ReChannel::trace_format::action_, \
+            ::ReChannel::trace_format::phase_); \
+    } else (void)0
+
+/**
+ * @brief Records the beginning of an action of an object.
+ * \note name_ is only evaluated on the first record of an object.
+ */
+#define RC_TRACE_BEGIN(obj_, name_, action_) \
+    _RC_TRACE_RECORD(obj_, name_, action_, BEGIN)
+
+/** @brief Records the end of an action of an object. */
+#define RC_TRACE_END(obj_, name_, action_) \
+    _RC_TRACE_RECORD(obj_, name_, action_, END)
+
+/** @brief Records an instantaneous action of an object. */
+#define RC_TRACE_INSTANT(obj_, name_, action_) \
+    _RC_TRACE_RECORD(obj_, name_, action_, INSTANT)
+
+#else // !RC_ENABLE_TRACE
+
+#define RC_TRACE_BEGIN(obj_, name_, action_)   (void)0
+#define RC_TRACE_END(obj_, name_, action_)     (void)0
+#define RC_TRACE_INSTANT(obj_, name_, action_) (void)0
+
+#endif // RC_ENABLE_TRACE
+
+#endif // RC_TRACE_H_
+
+//
+// $Id$
+//
@@ -0,0 +1,122 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_trace_format.h
+ * @brief   The binary file format of the trace recorder
+ *
+ * This header does not depend on SystemC. It is shared by the trace
+ * recorder and the trace converter (tools/rc_trace2json).
+ */
+
+#ifndef RC_TRACE_FORMAT_H_
+#define RC_TRACE_FORMAT_H_
+
+#include <boost/cstdint.hpp>
+
+namespace ReChannel {
+namespace trace_format {
+
+/*
+ * A trace file starts with a header, which is followed by a sequence of
+ * chunks. Each chunk starts with a one byte chunk kind:
+ *
+ *   CHUNK_OBJECT:  uint32 object id, uint32 name length, name (no '\0')
+ *   CHUNK_RECORDS: uint32 record count, records
+ *
+ * The object chunk of an id always precedes the records referring to it.
+ * All values are stored in the byte order of the recording machine.
+ */
+
+/** @brief the magic number at the beginning of a trace file */
+const char magic[8] = { 'R', 'C', 'T', 'R', 'A', 'C', 'E', '1' };
+
+/** @brief the kinds of chunks */
+enum chunk_kind
+{
+    CHUNK_OBJECT  = 1,
+    CHUNK_RECORDS = 2
+};
+
+/** @brief the traced actions */
+enum action
+{
+    LOAD = 0,
+    ACTIVATE,
+    DEACTIVATE,
+    UNLOAD,
+    LOCK_WAIT,
+    DRAIN_WAIT,
+    SWITCH_OPEN,
+    SWITCH_CLOSE,
+    SWITCH_UNDEF,
+    ACTION_COUNT
+};
+
+/** @brief the phase of a record (as in the Chrome trace format) */
+enum phase
+{
+    BEGIN   = 'B',
+    END     = 'E',
+    INSTANT = 'i'
+};
+
+/** @brief the file header */
+struct header
+{
+    char   magic[8];
+    /** @brief the simulation time resolution in seconds */
+    double time_resolution;
+};
+
+/** @brief a trace record */
+struct record
+{
+    boost::uint32_t object_id;
+    boost::uint16_t action;
+    boost::uint16_t phase;
+    /** @brief simulation time (in units of the time resolution) */
+    boost::uint64_t sim_time;
+    boost::uint64_t delta_count;
+    /** @brief wall-clock time since the start of the recording (in ns) */
+    boost::uint64_t wall_time;
+};
+
+/** @brief returns the name of the given action */
+inline const char* get_action_name(int action_)
+{
+    static const char* const names[ACTION_COUNT] = {
+        "load", "activate", "deactivate", "unload", "lock_wait",
+        "drain_wait", "switch_open", "switch_close", "switch_undef"
+    };
+    return (action_ >= 0 && action_ < ACTION_COUNT
+        ? names[action_] : "unknown");
+}
+
+} // namespace trace_format
+} // namespace ReChannel
+
+#endif // RC_TRACE_FORMAT_H_
+
+//
+// $Id$
+//
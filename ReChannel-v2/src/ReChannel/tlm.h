@@ -28,7 +28,12 @@
  * @brief   This header file can be optionally be included to use the SystemC
  *          TLM 2.0 library with ReChannel.
  *
- *          /todo implementation
+ *          It provides a portal for TLM 2.0 initiator sockets and an
+ *          exportal for TLM 2.0 target sockets. DMI pointers are passed
+ *          through and invalidated as soon as the switch is closed.
+ *
+ *          The temporally decoupled reconfiguration (see rc_local_time)
+ *          uses the quantum of tlm::tlm_global_quantum.
  *
  * $Date: 2007/10/09 00:22:26 $
  * $Revision: 1.4 $
@@ -37,7 +42,647 @@
 #ifndef RC_TLM_H_
 #define RC_TLM_H_
 
-/* TODO */
+#include <tlm.h>
+
+#include <map>
+
+#include "ReChannel/communication/portals/rc_portal.h"
+#include "ReChannel/communication/exportals/rc_exportal.h"
+#include "ReChannel/communication/accessors/rc_accessor.h"
+
+namespace ReChannel {
+
+/**
+ * @brief Port traits of a TLM 2.0 initiator socket.
+ */
+template<unsigned int BUSWIDTH, class TYPES, int N, sc_port_policy POL>
+struct rc_port_traits<tlm::tlm_initiator_socket<BUSWIDTH, TYPES, N, POL> >
+{
+    typedef tlm::tlm_initiator_socket<BUSWIDTH, TYPES, N, POL> type;
+    typedef tlm::tlm_fw_transport_if<TYPES> if_type;
+};
+
+/**
+ * @brief Fallback interface for the TLM 2.0 forward path.
+ *
+ * Transactions are answered with TLM_INCOMPLETE_RESPONSE.
+ */
+template<class TYPES>
+class rc_fallback_interface<tlm::tlm_fw_transport_if<TYPES> >
+    : virtual public tlm::tlm_fw_transport_if<TYPES>
+{
+public:
+    typedef typename TYPES::tlm_payload_type transaction_type;
+    typedef typename TYPES::tlm_phase_type   phase_type;
+public:
+    rc_fallback_interface() { }
+    virtual void b_transport(transaction_type& trans, sc_time& t)
+        { trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE); }
+    virtual tlm::tlm_sync_enum nb_transport_fw(
+        transaction_type& trans, phase_type& phase, sc_time& t)
+    {
+        trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        return tlm::TLM_COMPLETED;
+    }
+    virtual bool get_direct_mem_ptr(
+        transaction_type& trans, tlm::tlm_dmi& dmi_data)
+        { dmi_data.allow_none(); return false; }
+    virtual unsigned int transport_dbg(transaction_type& trans)
+        { return 0; }
+};
+
+namespace internals {
+namespace tlm_support {
+
+/**
+ * @brief Brackets an access of the backward path (internally used).
+ */
+template<class SWITCH>
+class bw_access
+{
+private:
+    typedef rc_interface_wrapper_base::transaction_tag transaction_tag;
+
+public:
+    explicit bw_access(SWITCH& switch_)
+        : p_switch(switch_),
+          p_process_behavior_change(switch_.begin_access_callback(p_tag))
+    { }
+
+    ~bw_access()
+        { p_switch.end_access_callback(p_tag); }
+
+private:
+    SWITCH&                    p_switch;
+    transaction_tag            p_tag;
+    rc_process_behavior_change p_process_behavior_change;
+
+private:
+    // disabled
+    bw_access(const bw_access& orig);
+    bw_access& operator=(const bw_access& orig);
+};
+
+/**
+ * @brief Counts an AT transaction across its phases (internally used).
+ *
+ * The accessor of the forward path reports the beginning and the end of
+ * a non-blocking transaction to the switch, which keeps it counted in
+ * between.
+ */
+template<class TYPES>
+class at_transaction_counter
+{
+public:
+    typedef typename TYPES::tlm_payload_type transaction_type;
+
+public:
+    /** @brief begins counting the transaction (if not yet counted) */
+    virtual void begin_at_transaction(transaction_type& trans) = 0;
+
+    /** @brief ends counting the transaction (if counted) */
+    virtual void end_at_transaction(transaction_type& trans) = 0;
+
+protected:
+    virtual ~at_transaction_counter() {}
+};
+
+/**
+ * @brief The pending AT transactions of a switch (internally used).
+ *
+ * A transaction is counted by the switch from BEGIN_REQ until END_RESP
+ * or TLM_COMPLETED. The transactions are identified by their payload.
+ */
+template<class SWITCH, class TYPES>
+class at_transaction_map
+    : public at_transaction_counter<TYPES>
+{
+private:
+    typedef rc_interface_wrapper_base::transaction_tag transaction_tag;
+    typedef typename TYPES::tlm_payload_type           transaction_type;
+    typedef std::map<transaction_type*, transaction_tag> tag_map;
+
+public:
+    explicit at_transaction_map(SWITCH& switch_)
+        : p_switch(switch_)
+    { }
+
+    virtual void begin_at_transaction(transaction_type& trans)
+    {
+        typename tag_map::iterator it = p_tag_map.lower_bound(&trans);
+        if (it == p_tag_map.end() || it->first != &trans) {
+            it = p_tag_map.insert(
+                it, typename tag_map::value_type(&trans, transaction_tag()));
+            p_switch.begin_access_callback(it->second);
+        }
+    }
+
+    virtual void end_at_transaction(transaction_type& trans)
+    {
+        typename tag_map::iterator it = p_tag_map.find(&trans);
+        if (it != p_tag_map.end()) {
+            const transaction_tag tag = it->second;
+            p_tag_map.erase(it);
+            p_switch.end_access_callback(tag);
+        }
+    }
+
+private:
+    SWITCH& p_switch;
+    tag_map p_tag_map;
+
+private:
+    // disabled
+    at_transaction_map(const at_transaction_map& orig);
+    at_transaction_map& operator=(const at_transaction_map& orig);
+};
+
+/**
+ * @brief Address range covered by granted DMI pointers (internally used).
+ */
+class dmi_range
+{
+public:
+    dmi_range()
+        : p_is_valid(false), p_start(0), p_end(0)
+    { }
+
+    void add(const tlm::tlm_dmi& dmi_data)
+    {
+        if (!p_is_valid) {
+            p_start = dmi_data.get_start_address();
+            p_end = dmi_data.get_end_address();
+            p_is_valid = true;
+        } else {
+            if (dmi_data.get_start_address() < p_start) {
+                p_start = dmi_data.get_start_address();
+            }
+            if (dmi_data.get_end_address() > p_end) {
+                p_end = dmi_data.get_end_address();
+            }
+        }
+    }
+
+    inline bool is_valid() const
+        { return p_is_valid; }
+
+    inline sc_dt::uint64 get_start() const
+        { return p_start; }
+
+    inline sc_dt::uint64 get_end() const
+        { return p_end; }
+
+    inline void clear()
+        { p_is_valid = false; }
+
+private:
+    bool          p_is_valid;
+    sc_dt::uint64 p_start;
+    sc_dt::uint64 p_end;
+};
+
+/**
+ * @brief Binds rc_local_time to the TLM 2.0 global quantum
+ *        (internally used).
+ */
+class global_quantum_binding
+{
+public:
+    global_quantum_binding()
+    {
+        rc_local_time::bind_global_quantum(
+            tlm::tlm_global_quantum::instance().get());
+    }
+};
+
+// (each translation unit including this header binds the quantum)
+static const global_quantum_binding s_global_quantum_binding;
+
+} // namespace tlm_support
+} // namespace internals
+
+/**
+ * @brief Accessor for the TLM 2.0 forward path.
+ *
+ * b_transport() stalls while the switch is closed, the non-blocking
+ * calls are answered by the fallback interface instead. An AT
+ * transaction is reported to the switch from BEGIN_REQ until END_RESP or
+ * TLM_COMPLETED, so that a deactivation does not fall between its
+ * phases.
+ *
+ * The accessor records the address range of the DMI pointers it has
+ * passed through, so that the switch can invalidate them on closing.
+ */
+template<class TYPES>
+RC_ACCESSOR_TEMPLATE(tlm::tlm_fw_transport_if<TYPES>)
+{
+    RC_ACCESSOR_TEMPLATE_CTOR(tlm::tlm_fw_transport_if<TYPES>),
+        p_at_counter(NULL)
+    { }
+
+    typedef typename TYPES::tlm_payload_type transaction_type;
+    typedef typename TYPES::tlm_phase_type   phase_type;
+    typedef internals::tlm_support::at_transaction_counter<TYPES>
+        at_counter_type;
+
+    virtual void b_transport(transaction_type& trans, sc_time& t)
+    {
+        this->rc_forward(&if_type::b_transport, rc_ref(trans), rc_ref(t));
+    }
+    virtual tlm::tlm_sync_enum nb_transport_fw(
+        transaction_type& trans, phase_type& phase, sc_time& t)
+    {
+        if (p_at_counter == NULL) {
+            return this->rc_nb_forward(
+                &if_type::nb_transport_fw,
+                rc_ref(trans), rc_ref(phase), rc_ref(t));
+        }
+        if (phase == tlm::BEGIN_REQ) {
+            p_at_counter->begin_at_transaction(trans);
+        }
+        const tlm::tlm_sync_enum sync = this->rc_nb_forward(
+            &if_type::nb_transport_fw,
+            rc_ref(trans), rc_ref(phase), rc_ref(t));
+        if (sync == tlm::TLM_COMPLETED || phase == tlm::END_RESP) {
+            p_at_counter->end_at_transaction(trans);
+        }
+        return sync;
+    }
+    virtual bool get_direct_mem_ptr(
+        transaction_type& trans, tlm::tlm_dmi& dmi_data)
+    {
+        const bool is_granted = this->rc_nb_forward(
+            &if_type::get_direct_mem_ptr, rc_ref(trans), rc_ref(dmi_data));
+        if (is_granted) {
+            p_dmi_range.add(dmi_data);
+        }
+        return is_granted;
+    }
+    virtual unsigned int transport_dbg(transaction_type& trans)
+    {
+        return this->rc_nb_forward(&if_type::transport_dbg, rc_ref(trans));
+    }
+
+    /** @brief returns the range of the DMI pointers passed through */
+    internals::tlm_support::dmi_range& rc_get_dmi_range()
+        { return p_dmi_range; }
+
+    /** @brief sets the switch that counts the AT transactions */
+    void rc_set_at_counter(at_counter_type* at_counter)
+        { p_at_counter = at_counter; }
+
+private:
+    at_counter_type*                  p_at_counter;
+    internals::tlm_support::dmi_range p_dmi_range;
+};
+
+/**
+ * @brief Portal for a TLM 2.0 initiator socket.
+ *
+ * The static_port is an initiator socket that can be bound to the target
+ * socket of the static side. The forward path is switched by the
+ * accessor of the currently active module. The backward path is
+ * implemented by the portal, which forwards it to the initiator socket
+ * of the active module.
+ *
+ * DMI pointers granted to a dynamic module are invalidated as soon as
+ * the portal is closed or set to undefined state.
+ */
+template<unsigned int BUSWIDTH, class TYPES, int N, sc_port_policy POL>
+struct rc_portal<tlm::tlm_initiator_socket<BUSWIDTH, TYPES, N, POL> >
+    : public rc_abstract_portal<
+          tlm::tlm_initiator_socket<BUSWIDTH, TYPES, N, POL> >,
+      virtual public tlm::tlm_bw_transport_if<TYPES>
+{
+private:
+    typedef tlm::tlm_initiator_socket<BUSWIDTH, TYPES, N, POL> socket_type;
+    typedef rc_abstract_portal<socket_type> base_type;
+    typedef rc_portal<socket_type>          this_type;
+    typedef internals::tlm_support::bw_access<this_type> bw_access;
+    typedef internals::tlm_support::at_transaction_map<this_type, TYPES>
+        at_transaction_map;
+
+    friend class internals::tlm_support::bw_access<this_type>;
+    friend class internals::tlm_support::at_transaction_map<
+        this_type, TYPES>;
+
+public:
+    typedef typename base_type::port_type     port_type;
+    typedef typename base_type::if_type       if_type;
+    typedef typename base_type::accessor_type accessor_type;
+
+    typedef tlm::tlm_bw_transport_if<TYPES>  bw_if_type;
+    typedef typename TYPES::tlm_payload_type transaction_type;
+    typedef typename TYPES::tlm_phase_type   phase_type;
+    typedef tlm::tlm_base_initiator_socket_b<BUSWIDTH, if_type, bw_if_type>
+        base_socket_type;
+
+public:
+    explicit rc_portal(
+        const sc_module_name& module_name_ =
+            sc_gen_unique_name("rc_portal"))
+        : base_type(module_name_),
+          p_cached_accessor(NULL), p_cached_bw_if(NULL),
+          p_at_transactions(*this)
+    {
+        // the backward path of the static side ends at this portal
+        this->static_port.bind(static_cast<bw_if_type&>(*this));
+    }
+
+    virtual tlm::tlm_sync_enum nb_transport_bw(
+        transaction_type& trans, phase_type& phase, sc_time& t)
+    {
+        tlm::tlm_sync_enum sync = tlm::TLM_COMPLETED;
+        bw_if_type* const bw_if = this->_rc_get_dynamic_bw_if();
+        if (bw_if != NULL) {
+            bw_access access(*this);
+            sync = bw_if->nb_transport_bw(trans, phase, t);
+        }
+        // (the response status is left to the target)
+        if (sync == tlm::TLM_COMPLETED || phase == tlm::END_RESP) {
+            p_at_transactions.end_at_transaction(trans);
+        }
+        return sync;
+    }
+
+    virtual void invalidate_direct_mem_ptr(
+        sc_dt::uint64 start_range, sc_dt::uint64 end_range)
+    {
+        bw_if_type* const bw_if = this->_rc_get_dynamic_bw_if();
+        if (bw_if != NULL) {
+            bw_access access(*this);
+            bw_if->invalidate_direct_mem_ptr(start_range, end_range);
+        }
+    }
+
+    virtual void close()
+    {
+        accessor_type* const accessor = this->_rc_get_dynamic_accessor();
+        base_type::close();
+        this->_rc_invalidate_dmi(accessor);
+    }
+
+    virtual void set_undefined()
+    {
+        accessor_type* const accessor = this->_rc_get_dynamic_accessor();
+        base_type::set_undefined();
+        this->_rc_invalidate_dmi(accessor);
+    }
+
+protected:
+    RC_ON_REFRESH_NOTIFY() { }
+
+    virtual accessor_type* create_accessor() const
+    {
+        accessor_type* const accessor = base_type::create_accessor();
+        accessor->rc_set_at_counter(&p_at_transactions);
+        return accessor;
+    }
+
+private:
+    inline accessor_type* _rc_get_dynamic_accessor() const
+    {
+        return dynamic_cast<accessor_type*>(
+            this->get_dynamic_interface());
+    }
+
+    // returns the backward interface of the active module (or NULL)
+    bw_if_type* _rc_get_dynamic_bw_if()
+    {
+        if (this->get_switch_state() != rc_switch::OPEN) {
+            return NULL;
+        }
+        return this->_rc_get_bw_if(this->_rc_get_dynamic_accessor());
+    }
+
+    // returns the backward interface of the accessor's module (or NULL)
+    bw_if_type* _rc_get_bw_if(accessor_type* accessor)
+    {
+        if (accessor != p_cached_accessor) {
+            p_cached_accessor = accessor;
+            p_cached_bw_if = NULL;
+            if (accessor != NULL && accessor->rc_get_bound_port_count() > 0)
+            {
+                base_socket_type* const socket =
+                    dynamic_cast<base_socket_type*>(
+                        accessor->rc_get_bound_port(0));
+                if (socket != NULL) {
+                    p_cached_bw_if = &socket->get_base_interface();
+                }
+            }
+        }
+        return p_cached_bw_if;
+    }
+
+    // invalidates the DMI pointers that passed the given accessor
+    void _rc_invalidate_dmi(accessor_type* accessor)
+    {
+        if (accessor == NULL || !accessor->rc_get_dmi_range().is_valid()) {
+            return;
+        }
+        internals::tlm_support::dmi_range& range =
+            accessor->rc_get_dmi_range();
+        range.clear();
+        bw_if_type* const bw_if = this->_rc_get_bw_if(accessor);
+        if (bw_if != NULL) {
+            bw_if->invalidate_direct_mem_ptr(
+                range.get_start(), range.get_end());
+        }
+    }
+
+private:
+    accessor_type*             p_cached_accessor;
+    bw_if_type*                p_cached_bw_if;
+    mutable at_transaction_map p_at_transactions;
+};
+
+/**
+ * @brief Exportal switch for a TLM 2.0 target socket.
+ *
+ * The forward path is switched to the target socket of the currently
+ * active module. The backward path of the dynamic target sockets ends at
+ * the exportal, which forwards it to the static initiator socket.
+ *
+ * DMI pointers granted to the static side are invalidated as soon as
+ * the exportal is closed or set to undefined state.
+ */
+template<class TYPES>
+struct rc_exportal<tlm::tlm_fw_transport_if<TYPES> >
+    : public rc_abstract_exportal<tlm::tlm_fw_transport_if<TYPES> >,
+      virtual public tlm::tlm_bw_transport_if<TYPES>
+{
+private:
+    typedef rc_abstract_exportal<tlm::tlm_fw_transport_if<TYPES> >
+        base_type;
+    typedef rc_exportal<tlm::tlm_fw_transport_if<TYPES> > this_type;
+    typedef internals::tlm_support::bw_access<this_type>  bw_access;
+    typedef internals::tlm_support::at_transaction_map<this_type, TYPES>
+        at_transaction_map;
+
+    friend class internals::tlm_support::bw_access<this_type>;
+    friend class internals::tlm_support::at_transaction_map<
+        this_type, TYPES>;
+
+public:
+    typedef tlm::tlm_fw_transport_if<TYPES>  if_type;
+    typedef rc_accessor<if_type>             accessor_type;
+    typedef tlm::tlm_bw_transport_if<TYPES>  bw_if_type;
+    typedef typename TYPES::tlm_payload_type transaction_type;
+    typedef typename TYPES::tlm_phase_type   phase_type;
+
+public:
+    explicit rc_exportal(
+        const sc_module_name& module_name_ =
+            sc_gen_unique_name("rc_exportal"))
+        : base_type(module_name_),
+          static_bw_port("static_bw_port"), p_dmi_accessor(NULL),
+          p_at_transactions(*this)
+    { }
+
+    using base_type::bind_static;
+    using base_type::bind_dynamic;
+
+    /** @brief bind a static initiator socket to this exportal */
+    template<unsigned int BUSWIDTH, int N, sc_port_policy POL>
+    void bind_static(
+        tlm::tlm_initiator_socket<BUSWIDTH, TYPES, N, POL>& socket_)
+    {
+        socket_.get_base_port().bind(this->static_export());
+        static_bw_port.bind(socket_.get_base_export());
+    }
+
+    /** @brief bind a dynamic target socket to this exportal */
+    template<unsigned int BUSWIDTH, int N, sc_port_policy POL>
+    void bind_dynamic(
+        tlm::tlm_target_socket<BUSWIDTH, TYPES, N, POL>& socket_)
+    {
+        base_type::bind_dynamic(socket_.get_base_export());
+        socket_.get_base_port().bind(static_cast<bw_if_type&>(*this));
+    }
+
+    virtual tlm::tlm_sync_enum nb_transport_bw(
+        transaction_type& trans, phase_type& phase, sc_time& t)
+    {
+        tlm::tlm_sync_enum sync = tlm::TLM_COMPLETED;
+        if (this->_rc_is_bw_open()) {
+            bw_access access(*this);
+            sync = static_bw_port->nb_transport_bw(trans, phase, t);
+        }
+        // (the response status is left to the target)
+        if (sync == tlm::TLM_COMPLETED || phase == tlm::END_RESP) {
+            p_at_transactions.end_at_transaction(trans);
+        }
+        return sync;
+    }
+
+    virtual void invalidate_direct_mem_ptr(
+        sc_dt::uint64 start_range, sc_dt::uint64 end_range)
+    {
+        if (this->_rc_is_bw_open()) {
+            bw_access access(*this);
+            static_bw_port->invalidate_direct_mem_ptr(
+                start_range, end_range);
+        }
+    }
+
+    virtual void close()
+    {
+        base_type::close();
+        this->_rc_invalidate_dmi();
+    }
+
+    virtual void set_undefined()
+    {
+        base_type::set_undefined();
+        this->_rc_invalidate_dmi();
+    }
+
+protected:
+    RC_ON_REFRESH_NOTIFY() { }
+
+    virtual accessor_type* create_accessor() const
+    {
+        p_dmi_accessor = base_type::create_accessor();
+        p_dmi_accessor->rc_set_at_counter(&p_at_transactions);
+        return p_dmi_accessor;
+    }
+
+private:
+    // invalidates the DMI pointers granted to the static side
+    void _rc_invalidate_dmi()
+    {
+        if (p_dmi_accessor == NULL
+        || !p_dmi_accessor->rc_get_dmi_range().is_valid()) {
+            return;
+        }
+        internals::tlm_support::dmi_range& range =
+            p_dmi_accessor->rc_get_dmi_range();
+        range.clear();
+        if (static_bw_port.get_interface() != NULL) {
+            static_bw_port->invalidate_direct_mem_ptr(
+                range.get_start(), range.get_end());
+        }
+    }
+
+    inline bool _rc_is_bw_open()
+    {
+        return (this->get_switch_state() == rc_switch::OPEN
+            && static_bw_port.get_interface() != NULL);
+    }
+
+public:
+    /** @brief the port of the static backward path */
+    sc_port<bw_if_type, 1, SC_ZERO_OR_MORE_BOUND> static_bw_port;
+
+private:
+    mutable accessor_type*     p_dmi_accessor;
+    mutable at_transaction_map p_at_transactions;
+};
+
+/* named portal and exportal specializations */
+
+/**
+ * @brief Portal for a TLM 2.0 initiator socket (named).
+ */
+template<
+    unsigned int BUSWIDTH=32, class TYPES=tlm::tlm_base_protocol_types>
+class rc_tlm_initiator_portal
+    : public rc_portal<tlm::tlm_initiator_socket<BUSWIDTH, TYPES> >
+{
+    typedef rc_portal<tlm::tlm_initiator_socket<BUSWIDTH, TYPES> >
+        base_type;
+public:
+    typedef typename base_type::port_type     port_type;
+    typedef typename base_type::if_type       if_type;
+    typedef typename base_type::accessor_type accessor_type;
+
+    explicit rc_tlm_initiator_portal(
+        const sc_module_name& name_ =
+            sc_gen_unique_name("rc_tlm_initiator_portal"))
+        : base_type(name_)
+    { }
+};
+
+/**
+ * @brief Exportal switch for a TLM 2.0 target socket (named).
+ */
+template<class TYPES=tlm::tlm_base_protocol_types>
+class rc_tlm_target_exportal
+    : public rc_exportal<tlm::tlm_fw_transport_if<TYPES> >
+{
+    typedef rc_exportal<tlm::tlm_fw_transport_if<TYPES> > base_type;
+public:
+    typedef typename base_type::if_type       if_type;
+    typedef typename base_type::accessor_type accessor_type;
+
+    explicit rc_tlm_target_exportal(
+        const sc_module_name& name_ =
+            sc_gen_unique_name("rc_tlm_target_exportal"))
+        : base_type(name_)
+    { }
+};
+
+} // namespace ReChannel
 
 #endif // RC_TLM_H_
 
@@ -35,24 +35,36 @@
  */
 
 #include "rc_delta_sync_object.h"
+#include <algorithm>
 
 namespace ReChannel {
 
 rc_delta_sync_object::rc_delta_sync_object(
     delta_sync_callback_type callback, bool enabled)
-    : sc_prim_channel(sc_gen_unique_name("_rc_delta_sync_object")),
-      p_enabled(enabled), p_callback(callback)
-{ }
+    : p_enabled(enabled), p_is_queued(false), p_callback(callback)
+{
+    // make sure the dispatcher is created during elaboration
+    rc_delta_sync_dispatcher::get_instance();
+}
 
 rc_delta_sync_object::rc_delta_sync_object()
-    : sc_prim_channel(sc_gen_unique_name("_rc_delta_sync_object")),
-      p_enabled(false)
-{ }
+    : p_enabled(false), p_is_queued(false)
+{
+    // make sure the dispatcher is created during elaboration
+    rc_delta_sync_dispatcher::get_instance();
+}
+
+rc_delta_sync_object::~rc_delta_sync_object()
+{
+    if (p_is_queued) {
+        rc_delta_sync_dispatcher::get_instance()._rc_dequeue(*this);
+    }
+}
 
 void rc_delta_sync_object::request_update()
 {
-    if (p_enabled) {
-        sc_prim_channel::request_update();
+    if (p_enabled && !p_is_queued) {
+        rc_delta_sync_dispatcher::get_instance()._rc_enqueue(*this);
     }
 }
 
@@ -73,6 +85,56 @@ void rc_delta_sync_object::update()
     }
 }
 
+/* rc_delta_sync_dispatcher */
+
+rc_delta_sync_dispatcher* rc_delta_sync_dispatcher::s_instance = NULL;
+
+rc_delta_sync_dispatcher::rc_delta_sync_dispatcher()
+    : sc_prim_channel(sc_gen_unique_name("_rc_delta_sync_dispatcher")),
+      p_is_updating(false)
+{ }
+
+void rc_delta_sync_dispatcher::_rc_enqueue(
+    rc_delta_sync_object& delta_sync)
+{
+    if (p_queue.empty() && !p_is_updating) {
+        sc_prim_channel::request_update();
+    }
+    delta_sync.p_is_queued = true;
+    p_queue.push_back(&delta_sync);
+}
+
+void rc_delta_sync_dispatcher::_rc_dequeue(
+    rc_delta_sync_object& delta_sync)
+{
+    delta_sync_vector::iterator it =
+        std::find(p_queue.begin(), p_queue.end(), &delta_sync);
+    if (it != p_queue.end()) {
+        // (erasing would invalidate the position of a running update())
+        *it = NULL;
+    }
+    delta_sync.p_is_queued = false;
+}
+
+void rc_delta_sync_dispatcher::update()
+{
+    p_is_updating = true;
+    // note: the queue may grow while it is processed
+    for (unsigned int i = 0; i < p_queue.size(); ++i) {
+        rc_delta_sync_object* delta_sync = p_queue[i];
+        if (delta_sync != NULL) {
+            delta_sync->update();
+        }
+    }
+    for (unsigned int i = 0; i < p_queue.size(); ++i) {
+        if (p_queue[i] != NULL) {
+            p_queue[i]->p_is_queued = false;
+        }
+    }
+    p_queue.clear();
+    p_is_updating = false;
+}
+
 } // namespace ReChannel
 
 //
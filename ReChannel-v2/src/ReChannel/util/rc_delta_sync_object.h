@@ -38,22 +38,32 @@
 
 #include <systemc.h>
 #include <boost/function.hpp>
+#include <vector>
 
 namespace ReChannel {
 
+class rc_delta_sync_dispatcher;
+
 /**
- * @brief Helper channel to synchronise arbitrary operations
+ * @brief Helper object to synchronise arbitrary operations
  *        with delta cycle borders.
  *
  * If this is object is enabled (see set_enabled()) a call to request_update()
- * will trigger the update of the channel at the end of the current delta cycle.
+ * will trigger an update at the end of the current delta cycle.
  * A user-specified callback function is then called during the following
  * update phase of SystemC. This mechanism allows operations to be
  * synchronised with the delta cycle transitions.
+ *
+ * \remarks rc_delta_sync_object is not a channel by itself. All pending
+ * requests are collected by the library-wide rc_delta_sync_dispatcher,
+ * which is the only primitive channel registered with the kernel.
+ * Hence, the number of delta sync objects does not affect the
+ * length of the kernel's update list.
  */
 class rc_delta_sync_object
-    : protected sc_prim_channel
 {
+    friend class rc_delta_sync_dispatcher;
+
 public:
     /**
      * @brief the type of the callback function
@@ -68,7 +78,7 @@ public:
     /**
      * @brief default constructor
      *
-     * Initially the channel is disabled and no callback is set.
+     * Initially the object is disabled and no callback is set.
      */
     rc_delta_sync_object();
 
@@ -81,19 +91,24 @@ public:
     rc_delta_sync_object(
         delta_sync_callback_type callback, bool enabled=false);
 
+    /**
+     * @brief destructor (withdraws a pending request)
+     */
+    virtual ~rc_delta_sync_object();
+
     /**
      * @brief Requests a call to the callback at the end of this delta cycle.
      */
     virtual void request_update();
 
     /**
-     * @brief Returns if the channel is enabled.
+     * @brief Returns if the object is enabled.
      */
     inline bool is_enabled() const
         { return p_enabled; }
 
     /**
-     * @brief Sets the activity state of the channel.
+     * @brief Sets the activity state of the object.
      */
     inline void set_enabled(bool b)
         { p_enabled = b; }
@@ -114,6 +129,10 @@ private:
      * @brief the "enabled" flag
      */
     bool                     p_enabled;
+    /**
+     * @brief is set while a request is pending at the dispatcher
+     */
+    bool                     p_is_queued;
     /**
      * @brief the user-specified callback
      */
@@ -127,6 +146,86 @@ private:
     rc_delta_sync_object& operator=(const rc_delta_sync_object& orig);
 };
 
+/**
+ * @brief The library-wide update dispatcher of the delta sync objects.
+ *
+ * The dispatcher queues the rc_delta_sync_object instances which requested
+ * an update and processes them within a single update() call. Each
+ * object is updated at most once per update phase, in the order of its
+ * first request. An object requested by a callback during the update
+ * phase is processed within the same update() call, since the kernel
+ * does not accept update requests from within the update phase.
+ *
+ * \remarks The dispatcher is created on first use, i.e. at the
+ * construction of the first rc_delta_sync_object during elaboration.
+ */
+class rc_delta_sync_dispatcher
+    : protected sc_prim_channel
+{
+    friend class rc_delta_sync_object;
+
+public:
+    /**
+     * @brief Returns the dispatcher instance.
+     */
+    static rc_delta_sync_dispatcher& get_instance()
+    {
+        if (s_instance == NULL) {
+            s_instance = new rc_delta_sync_dispatcher();
+        }
+        return *s_instance;
+    }
+
+protected:
+    /**
+     * @brief Updates all queued delta sync objects.
+     */
+    virtual void update();
+
+private:
+    /**
+     * @brief constructor
+     */
+    rc_delta_sync_dispatcher();
+
+    /**
+     * @brief Queues the delta sync object. (internal only)
+     */
+    void _rc_enqueue(rc_delta_sync_object& delta_sync);
+
+    /**
+     * @brief Withdraws a pending request. (internal only)
+     */
+    void _rc_dequeue(rc_delta_sync_object& delta_sync);
+
+private:
+    typedef std::vector<rc_delta_sync_object*> delta_sync_vector;
+
+private:
+    /**
+     * @brief the objects to be updated in the next update phase
+     */
+    delta_sync_vector p_queue;
+    /**
+     * @brief is set while update() is running
+     */
+    bool              p_is_updating;
+
+private:
+    /**
+     * @brief the dispatcher instance
+     */
+    static rc_delta_sync_dispatcher* s_instance;
+
+private:
+    // disabled
+    /** @brief //(disabled) */
+    rc_delta_sync_dispatcher(const rc_delta_sync_dispatcher& orig);
+    /** @brief //(disabled) */
+    rc_delta_sync_dispatcher& operator=(
+        const rc_delta_sync_dispatcher& orig);
+};
+
 } // namespace ReChannel
 
 #endif // RC_DELTA_SYNC_OBJECT_H_
@@ -177,6 +177,9 @@ void nb_driver_access_call::operator()(
 {
     // create the write call and append it to the write call vector
     dobj.m_write_call_vector->push_back(write_call(call_obj));
+    RC_STATS_INC(
+        static_cast<const rc_driver_object_base*>(&dobj),
+        DRIVER_WRITE_QUEUED);
     // signal the driver object that a new write call is pending
     //   by notifying the pending write event
     if (!*dobj.m_pending_write_event_notified) {
@@ -196,6 +199,9 @@ void driver_access_call<void>::operator()(
     // create the write call and append it to the write call vector
     dobj.m_write_call_vector->push_back(
         write_call(call_obj, &write_done_event, &thrown_obj));
+    RC_STATS_INC(
+        static_cast<const rc_driver_object_base*>(&dobj),
+        DRIVER_WRITE_QUEUED);
     // signal the driver object that a new write call is pending
     //   by notifying the pending write event
     if (!*dobj.m_pending_write_event_notified) {
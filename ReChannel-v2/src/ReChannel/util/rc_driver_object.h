@@ -78,6 +78,7 @@
 #include <boost/type_traits/is_void.hpp>
 
 #include "ReChannel/util/rc_throwable.h"
+#include "ReChannel/util/rc_stats.h"
 
 namespace ReChannel {
 
@@ -1294,6 +1295,9 @@ R driver_access_call<R>::operator()(
             boost::bind(
                 copy_retval(), call_obj, &ret),
             &write_done_event, &thrown_obj));
+    RC_STATS_INC(
+        static_cast<const rc_driver_object_base*>(&dobj),
+        DRIVER_WRITE_QUEUED);
     // signal the driver object that a new write call is pending
     //   by notifying the pending write event
     if (!*dobj.m_pending_write_event_notified) {
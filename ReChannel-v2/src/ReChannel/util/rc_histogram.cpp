@@ -0,0 +1,124 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_histogram.cpp
+ * @brief   Class rc_histogram
+ */
+
+#include "rc_histogram.h"
+
+namespace ReChannel {
+
+rc_histogram::rc_histogram()
+{
+    this->clear();
+}
+
+void rc_histogram::add(sc_dt::uint64 value)
+{
+    if (m_count == 0 || value < m_min) {
+        m_min = value;
+    }
+    if (value > m_max) {
+        m_max = value;
+    }
+    ++m_count;
+    m_sum += value;
+    ++m_buckets[get_bucket(value)];
+}
+
+void rc_histogram::clear()
+{
+    m_count = 0;
+    m_sum = 0;
+    m_min = 0;
+    m_max = 0;
+    for (int i=0; i < BUCKET_COUNT; i++) {
+        m_buckets[i] = 0;
+    }
+}
+
+double rc_histogram::get_mean() const
+{
+    if (m_count == 0) {
+        return 0.0;
+    }
+    return (double)m_sum / (double)m_count;
+}
+
+int rc_histogram::get_bucket(sc_dt::uint64 value)
+{
+    int bucket = 0;
+    while (value != 0) {
+        value >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+sc_dt::uint64 rc_histogram::get_bucket_lower_bound(int bucket)
+{
+    if (bucket <= 0) {
+        return 0;
+    }
+    return ((sc_dt::uint64)1) << (bucket - 1);
+}
+
+sc_dt::uint64 rc_histogram::get_bucket_upper_bound(int bucket)
+{
+    if (bucket <= 0) {
+        return 0;
+    } else if (bucket >= BUCKET_COUNT - 1) {
+        return ~((sc_dt::uint64)0);
+    }
+    return (((sc_dt::uint64)1) << bucket) - 1;
+}
+
+sc_dt::uint64 rc_histogram::get_percentile(double p) const
+{
+    if (m_count == 0) {
+        return 0;
+    }
+    // the rank of the requested sample (1-based)
+    unsigned long rank = (unsigned long)(p * m_count + 0.5);
+    if (rank < 1) {
+        rank = 1;
+    } else if (rank > m_count) {
+        rank = m_count;
+    }
+    unsigned long n = 0;
+    for (int i=0; i < BUCKET_COUNT; i++) {
+        n += m_buckets[i];
+        if (n >= rank) {
+            const sc_dt::uint64 upper = get_bucket_upper_bound(i);
+            return (upper < m_max ? upper : m_max);
+        }
+    }
+    return m_max;
+}
+
+} // namespace ReChannel
+
+//
+// $Id$
+//
@@ -0,0 +1,116 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_histogram.h
+ * @brief   Class rc_histogram
+ */
+
+#ifndef RC_HISTOGRAM_H_
+#define RC_HISTOGRAM_H_
+
+#include <systemc.h>
+
+namespace ReChannel {
+
+/** @brief A histogram with logarithmic buckets.
+ *
+ * rc_histogram counts unsigned integral samples (e.g. time values in
+ * units of the time resolution or numbers of delta cycles). Bucket 0
+ * holds the samples equal to zero, bucket i (i > 0) holds the samples
+ * within [2^(i-1), 2^i).
+ */
+class rc_histogram
+{
+public:
+    /** @brief The number of buckets. */
+    enum { BUCKET_COUNT=65 };
+
+public:
+    rc_histogram();
+
+    /** @brief Adds a sample. */
+    void add(sc_dt::uint64 value);
+
+    /** @brief Removes all samples. */
+    void clear();
+
+    /** @brief The number of samples. */
+    inline unsigned long get_count() const
+        { return m_count; }
+
+    /** @brief The sum of all samples. */
+    inline sc_dt::uint64 get_sum() const
+        { return m_sum; }
+
+    /** @brief The smallest sample (zero if empty). */
+    inline sc_dt::uint64 get_min() const
+        { return m_min; }
+
+    /** @brief The largest sample (zero if empty). */
+    inline sc_dt::uint64 get_max() const
+        { return m_max; }
+
+    /** @brief The arithmetic mean of the samples (zero if empty). */
+    double get_mean() const;
+
+    /** @brief The number of samples within the given bucket. */
+    inline unsigned long get_bucket_count(int bucket) const
+        { return m_buckets[bucket]; }
+
+    /** @brief Returns the bucket the given value belongs to. */
+    static int get_bucket(sc_dt::uint64 value);
+
+    /** @brief The smallest value of the given bucket. */
+    static sc_dt::uint64 get_bucket_lower_bound(int bucket);
+
+    /** @brief The largest value of the given bucket. */
+    static sc_dt::uint64 get_bucket_upper_bound(int bucket);
+
+    /** @brief Returns an upper bound of the given percentile.
+     *
+     * The result is the upper bound of the bucket the percentile falls
+     * into (limited by the largest sample).
+     * @param p the percentile within [0.0, 1.0]
+     */
+    sc_dt::uint64 get_percentile(double p) const;
+
+protected:
+    /** @brief the number of samples */
+    unsigned long m_count;
+    /** @brief the sum of all samples */
+    sc_dt::uint64 m_sum;
+    /** @brief the smallest sample */
+    sc_dt::uint64 m_min;
+    /** @brief the largest sample */
+    sc_dt::uint64 m_max;
+    /** @brief the sample counts of the buckets */
+    unsigned long m_buckets[BUCKET_COUNT];
+};
+
+} // namespace ReChannel
+
+#endif // RC_HISTOGRAM_H_
+
+//
+// $Id$
+//
@@ -0,0 +1,197 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_profiler.cpp
+ * @brief   Class rc_profiler
+ */
+
+#include "rc_profiler.h"
+
+#ifdef RC_ENABLE_PROFILER
+
+#include <iomanip>
+#include <sys/time.h>
+
+namespace ReChannel {
+
+rc_profiler::samples::samples()
+    : calls(0), count(0), discarded(0), cycles(0), tick(0)
+{ }
+
+rc_profiler::rc_profiler()
+    : p_cycle_base(read_cycle_counter()),
+      p_wall_time_base(_rc_get_wall_time())
+{ }
+
+void rc_profiler::set_switch(const void* obj, const std::string& name)
+{
+    object_decl& decl = _rc_get_instance().p_object_decl_map[obj];
+    decl.name = name;
+    decl.is_filter = false;
+}
+
+void rc_profiler::set_filter(const void* obj, const std::string& name)
+{
+    object_decl& decl = _rc_get_instance().p_object_decl_map[obj];
+    decl.name = name;
+    decl.is_filter = true;
+}
+
+double rc_profiler::get_cycles_per_second()
+{
+#ifdef RC_PROFILER_HAS_TSC
+    const rc_profiler& profiler = _rc_get_instance();
+    const cycle_type cycles = read_cycle_counter() - profiler.p_cycle_base;
+    const boost::uint64_t ns =
+        _rc_get_wall_time() - profiler.p_wall_time_base;
+    if (ns == 0 || cycles == 0) {
+        return 0.0;
+    }
+    return (double)cycles * 1e9 / (double)ns;
+#else
+    // the wall clock counts nanoseconds
+    return 1e9;
+#endif
+}
+
+const char* rc_profiler::get_kind_name(kind_type kind)
+{
+    static const char* const s_kind_names[KIND_COUNT] = {
+        "forward", "event" };
+
+    if ((int)kind < 0 || (int)kind >= KIND_COUNT) {
+        return "(unknown)";
+    }
+    return s_kind_names[kind];
+}
+
+void rc_profiler::dump(std::ostream& os)
+{
+    typedef std::map<std::string, samples> name_samples_map;
+
+    const rc_profiler& profiler = _rc_get_instance();
+    const double cycles_per_second = get_cycles_per_second();
+
+    // aggregate the object samples per switch and per filter
+    //   (sorted by name)
+    name_samples_map name_samples[KIND_COUNT];
+    for (int k=0; k < KIND_COUNT; k++) {
+        for (object_samples_map::const_iterator it =
+                profiler.p_object_samples_map[k].begin();
+            it != profiler.p_object_samples_map[k].end();
+            ++it)
+        {
+            // (the samples of each object exist from its construction)
+            if (it->second.calls == 0) {
+                continue;
+            }
+            object_decl_map::const_iterator decl_it =
+                profiler.p_object_decl_map.find(it->first);
+            std::string name = "(unattributed)";
+            if (decl_it != profiler.p_object_decl_map.end()) {
+                const object_decl& decl = decl_it->second;
+                name = (decl.is_filter ? "filter '" : "switch '")
+                    + decl.name + "'";
+            }
+            samples& sum = name_samples[k][name];
+            sum.calls += it->second.calls;
+            sum.count += it->second.count;
+            sum.discarded += it->second.discarded;
+            sum.cycles += it->second.cycles;
+        }
+    }
+
+    const std::ios::fmtflags flags = os.flags();
+    const std::streamsize precision = os.precision();
+    os << "ReChannel profile (sample period "
+       << RC_PROFILER_SAMPLE_PERIOD << ", "
+       << std::fixed << std::setprecision(1)
+       << cycles_per_second / 1e6 << " MHz):" << std::endl;
+    for (int k=0; k < KIND_COUNT; k++) {
+        for (name_samples_map::const_iterator it =
+                name_samples[k].begin();
+            it != name_samples[k].end();
+            ++it)
+        {
+            const samples& s = it->second;
+            double total_us = 0.0;
+            if (cycles_per_second > 0.0) {
+                total_us = (double)s.cycles * 1e6 / cycles_per_second;
+            }
+            os << "  " << it->first << " "
+               << get_kind_name((kind_type)k) << ":"
+               << " calls=" << s.calls
+               << " samples=" << s.count
+               << " discarded=" << s.discarded
+               << std::setprecision(3)
+               << " total_us=" << total_us
+               << " mean_us="
+               << (s.count > 0 ? total_us / s.count : 0.0)
+               << std::setprecision(1) << std::endl;
+        }
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void rc_profiler::reset()
+{
+    rc_profiler& profiler = _rc_get_instance();
+    // (the entries are kept, since running scopes may refer to them)
+    for (int k=0; k < KIND_COUNT; k++) {
+        for (object_samples_map::iterator it =
+                profiler.p_object_samples_map[k].begin();
+            it != profiler.p_object_samples_map[k].end();
+            ++it)
+        {
+            it->second = samples();
+        }
+    }
+}
+
+void rc_profiler::_rc_add_sample(
+    samples& s, cycle_type cycles, bool is_discarded)
+{
+    if (is_discarded) {
+        ++s.discarded;
+    } else {
+        ++s.count;
+        s.cycles += cycles;
+    }
+}
+
+boost::uint64_t rc_profiler::_rc_get_wall_time()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (boost::uint64_t)tv.tv_sec * 1000000000u
+        + (boost::uint64_t)tv.tv_usec * 1000u;
+}
+
+} // namespace ReChannel
+
+#endif // RC_ENABLE_PROFILER
+
+//
+// $Id$
+//
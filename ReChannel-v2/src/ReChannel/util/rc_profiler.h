@@ -0,0 +1,288 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_profiler.h
+ * @brief   Class rc_profiler (the sampling wall-clock profiler)
+ *
+ * The profiler is only compiled if RC_ENABLE_PROFILER is defined. The
+ * library and the application must be compiled with the same setting.
+ * Otherwise the profiler macros expand to nothing.
+ */
+
+#ifndef RC_PROFILER_H_
+#define RC_PROFILER_H_
+
+#ifndef RC_PROFILER_SAMPLE_PERIOD
+/**
+ * @brief Every RC_PROFILER_SAMPLE_PERIOD-th profiled call of an object
+ *        is measured.
+ */
+#define RC_PROFILER_SAMPLE_PERIOD 16
+#endif // RC_PROFILER_SAMPLE_PERIOD
+
+#ifdef RC_ENABLE_PROFILER
+
+#include <map>
+#include <string>
+#include <ostream>
+
+#include <boost/cstdint.hpp>
+
+#include "ReChannel/core/rc_common_header.h"
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define RC_PROFILER_HAS_TSC
+#endif
+
+namespace ReChannel {
+
+/** @brief Sampling wall-clock profiler of the communication layer.
+ *
+ * rc_profiler measures the wall-clock time spent inside the forwarding
+ * path of the accessors (accessor -> filters -> interface wrapper ->
+ * static interface) and inside the event forwarders. All calls are
+ * counted, but only every RC_PROFILER_SAMPLE_PERIOD-th call of an object
+ * is measured with the cycle counter of the processor (the time stamp
+ * counter on x86, the wall clock otherwise). Since each object has its
+ * own tick, the nested scopes of a filter chain are sampled
+ * independently of each other.
+ *
+ * A sampled call that suspends the calling process (i.e. the delta
+ * count has changed on return) is discarded, since its duration would
+ * include the execution of other processes.
+ *
+ * The measured objects are attributed by name: accessors of a portal
+ * or an exportal and event forwarders are attributed to the switch,
+ * filters are attributed to the filter. The time of a filter includes
+ * the time of the remaining filter chain.
+ *
+ * \remark Use the RC_PROFILER_* macros instead of calling rc_profiler
+ *         directly. They expand to nothing if RC_ENABLE_PROFILER is not
+ *         defined.
+ */
+class rc_profiler
+{
+public:
+    /** @brief The measured code path. */
+    enum kind_type { FORWARD=0, EVENT };
+
+    /** @brief The number of measured code paths. */
+    enum { KIND_COUNT=2 };
+
+    /** @brief The type of the cycle counter. */
+    typedef boost::uint64_t cycle_type;
+
+    class scope;
+
+    /**
+     * @brief The samples of an object.
+     *
+     * A measured object looks up its samples once on construction (see
+     * RC_PROFILER_GET_SAMPLES) and passes them to each scope.
+     */
+    struct samples
+    {
+        samples();
+
+        unsigned long calls;
+        unsigned long count;
+        unsigned long discarded;
+        cycle_type    cycles;
+        // (the calls since the last sample)
+        unsigned int  tick;
+    };
+
+private:
+    /** @brief The declaration of a measured object. */
+    struct object_decl
+    {
+        std::string name;
+        bool        is_filter;
+    };
+
+    typedef std::map<const void*, samples>     object_samples_map;
+    typedef std::map<const void*, object_decl> object_decl_map;
+
+public:
+    /** @brief declares an object as part of a switch */
+    static void set_switch(const void* obj, const std::string& name);
+
+    /** @brief declares an object as a filter */
+    static void set_filter(const void* obj, const std::string& name);
+
+    /**
+     * @brief returns the samples of an object
+     * \note The reference remains valid until the end of the simulation.
+     */
+    static inline samples& get_samples(const void* obj, kind_type kind);
+
+    /** @brief returns the current value of the cycle counter */
+    static inline cycle_type read_cycle_counter();
+
+    /** @brief returns the estimated cycle counter frequency (in Hz) */
+    static double get_cycles_per_second();
+
+    /** @brief returns the name of a measured code path */
+    static const char* get_kind_name(kind_type kind);
+
+    /** @brief writes the per-switch and the per-filter times */
+    static void dump(std::ostream& os);
+
+    /** @brief resets all samples (the declarations are retained) */
+    static void reset();
+
+private:
+    rc_profiler();
+
+    static inline rc_profiler& _rc_get_instance();
+
+    static void _rc_add_sample(
+        samples& s, cycle_type cycles, bool is_discarded);
+
+    static boost::uint64_t _rc_get_wall_time();
+
+private:
+    object_samples_map p_object_samples_map[KIND_COUNT];
+    object_decl_map    p_object_decl_map;
+    cycle_type         p_cycle_base;
+    boost::uint64_t    p_wall_time_base;
+
+private:
+    // disabled
+    rc_profiler(const rc_profiler& orig);
+    rc_profiler& operator=(const rc_profiler& orig);
+};
+
+/**
+ * @brief Measures the lifetime of a scope (if sampled).
+ */
+class rc_profiler::scope
+{
+public:
+    inline explicit scope(samples& s);
+
+    inline ~scope();
+
+private:
+    samples*      p_samples;
+    bool          p_is_sampled;
+    sc_dt::uint64 p_delta_count;
+    cycle_type    p_start;
+
+private:
+    // disabled
+    scope(const scope& orig);
+    scope& operator=(const scope& orig);
+};
+
+/* inline code */
+
+inline rc_profiler& rc_profiler::_rc_get_instance()
+{
+    static rc_profiler s_instance;
+    return s_instance;
+}
+
+inline rc_profiler::samples& rc_profiler::get_samples(
+    const void* obj, kind_type kind)
+{
+    return _rc_get_instance().p_object_samples_map[kind][obj];
+}
+
+inline rc_profiler::cycle_type rc_profiler::read_cycle_counter()
+{
+#ifdef RC_PROFILER_HAS_TSC
+    unsigned int lo, hi;
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((cycle_type)hi << 32) | lo;
+#else
+    return _rc_get_wall_time();
+#endif
+}
+
+inline rc_profiler::scope::scope(samples& s)
+    : p_samples(&s), p_is_sampled(false),
+      p_delta_count(0), p_start(0)
+{
+    ++p_samples->calls;
+    if (++p_samples->tick >= RC_PROFILER_SAMPLE_PERIOD) {
+        p_samples->tick = 0;
+        p_is_sampled = true;
+        p_delta_count = sc_delta_count();
+        p_start = read_cycle_counter();
+    }
+}
+
+inline rc_profiler::scope::~scope()
+{
+    if (p_is_sampled) {
+        const cycle_type end = read_cycle_counter();
+        _rc_add_sample(
+            *p_samples, end - p_start,
+            (sc_delta_count() != p_delta_count));
+    }
+}
+
+} // namespace ReChannel
+
+/**
+ * @brief Returns a pointer to the samples of an object.
+ * \note The object pointer has to be of the type it was declared with.
+ */
+#define RC_PROFILER_GET_SAMPLES(obj_, kind_) \
+    (&::ReChannel::rc_profiler::get_samples( \
+        (const void*)(obj_), ::ReChannel::rc_profiler::kind_))
+
+/**
+ * @brief Measures the rest of the enclosing scope.
+ * \note samples_ is a pointer obtained by RC_PROFILER_GET_SAMPLES.
+ */
+#define RC_PROFILER_SCOPE(samples_) \
+    ::ReChannel::rc_profiler::scope _rc_profiler_scope(*(samples_))
+
+/** @brief Declares an object as part of a switch. */
+#define RC_PROFILER_SET_SWITCH(obj_, name_) \
+    ::ReChannel::rc_profiler::set_switch((const void*)(obj_), name_)
+
+/** @brief Declares an object as a filter. */
+#define RC_PROFILER_SET_FILTER(obj_, name_) \
+    ::ReChannel::rc_profiler::set_filter((const void*)(obj_), name_)
+
+/** @brief Writes the measured times to the given stream. */
+#define RC_PROFILER_DUMP(os_) \
+    ::ReChannel::rc_profiler::dump(os_)
+
+#else // !RC_ENABLE_PROFILER
+
+#define RC_PROFILER_SCOPE(samples_)          (void)0
+#define RC_PROFILER_SET_SWITCH(obj_, name_)  (void)0
+#define RC_PROFILER_SET_FILTER(obj_, name_)  (void)0
+#define RC_PROFILER_DUMP(os_)                (void)0
+
+#endif // RC_ENABLE_PROFILER
+
+#endif // RC_PROFILER_H_
+
+//
+// $Id$
+//
@@ -0,0 +1,165 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_stats.cpp
+ * @brief   Class rc_stats
+ */
+
+#include "rc_stats.h"
+
+#ifdef RC_ENABLE_STATS
+
+namespace ReChannel {
+
+rc_stats::counters::counters()
+{
+    for (int i=0; i < COUNTER_COUNT; i++) {
+        count[i] = 0;
+    }
+}
+
+rc_stats::rc_stats()
+    : p_last_obj(NULL), p_last_counters(NULL)
+{ }
+
+void rc_stats::set_owner(const void* obj, const void* owner)
+{
+    rc_stats& stats = _rc_get_instance();
+    stats.p_owner_map[obj] = owner;
+}
+
+void rc_stats::register_switch(
+    const void* switch_obj, const std::string& name)
+{
+    rc_stats& stats = _rc_get_instance();
+    stats.p_switch_map[switch_obj] = name;
+}
+
+unsigned long rc_stats::get_count(counter_type counter)
+{
+    return _rc_get_instance().p_global_counters.count[counter];
+}
+
+unsigned long rc_stats::get_switch_count(
+    const void* switch_obj, counter_type counter)
+{
+    const rc_stats& stats = _rc_get_instance();
+    unsigned long sum = 0;
+    for (object_counters_map::const_iterator it =
+            stats.p_object_counters_map.begin();
+        it != stats.p_object_counters_map.end();
+        ++it)
+    {
+        if (stats._rc_resolve_switch(it->first) == switch_obj) {
+            sum += it->second.count[counter];
+        }
+    }
+    return sum;
+}
+
+const char* rc_stats::get_counter_name(counter_type counter)
+{
+    static const char* const s_counter_names[COUNTER_COUNT] = {
+        "fallback_calls", "consumed_cancels", "queued_driver_writes",
+        "suppressed_events" };
+
+    if ((int)counter < 0 || (int)counter >= COUNTER_COUNT) {
+        return "(unknown)";
+    }
+    return s_counter_names[counter];
+}
+
+void rc_stats::dump(std::ostream& os)
+{
+    typedef std::map<std::string, counters> name_counters_map;
+
+    const rc_stats& stats = _rc_get_instance();
+
+    // aggregate the object counts per switch (sorted by name)
+    name_counters_map switch_counters;
+    for (object_counters_map::const_iterator it =
+            stats.p_object_counters_map.begin();
+        it != stats.p_object_counters_map.end();
+        ++it)
+    {
+        const void* const switch_obj = stats._rc_resolve_switch(it->first);
+        std::string name = "(unattributed)";
+        if (switch_obj != NULL) {
+            name = "'" + stats.p_switch_map.find(switch_obj)->second + "'";
+        }
+        counters& sum = switch_counters[name];
+        for (int i=0; i < COUNTER_COUNT; i++) {
+            sum.count[i] += it->second.count[i];
+        }
+    }
+
+    os << "ReChannel statistics:" << std::endl;
+    os << "  global:";
+    for (int i=0; i < COUNTER_COUNT; i++) {
+        os << " " << get_counter_name((counter_type)i) << "="
+           << stats.p_global_counters.count[i];
+    }
+    os << std::endl;
+    for (name_counters_map::const_iterator it = switch_counters.begin();
+        it != switch_counters.end();
+        ++it)
+    {
+        os << "  " << it->first << ":";
+        for (int i=0; i < COUNTER_COUNT; i++) {
+            os << " " << get_counter_name((counter_type)i) << "="
+               << it->second.count[i];
+        }
+        os << std::endl;
+    }
+}
+
+void rc_stats::reset()
+{
+    rc_stats& stats = _rc_get_instance();
+    stats.p_global_counters = counters();
+    stats.p_object_counters_map.clear();
+    stats.p_last_obj = NULL;
+    stats.p_last_counters = NULL;
+}
+
+const void* rc_stats::_rc_resolve_switch(const void* obj) const
+{
+    // follow the chain of owners until a registered switch is found
+    //   (the depth is limited to guard against cyclic ownership)
+    for (int depth=0; obj != NULL && depth < 8; depth++) {
+        if (p_switch_map.find(obj) != p_switch_map.end()) {
+            return obj;
+        }
+        owner_map::const_iterator it = p_owner_map.find(obj);
+        obj = (it != p_owner_map.end() ? it->second : NULL);
+    }
+    return NULL;
+}
+
+} // namespace ReChannel
+
+#endif // RC_ENABLE_STATS
+
+//
+// $Id$
+//
@@ -0,0 +1,190 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    rc_stats.h
+ * @brief   Class rc_stats and the RC_STATS_* macros
+ *
+ * Note: The counters are only compiled if RC_ENABLE_STATS is defined.
+ *       Otherwise all RC_STATS_* macros expand to nothing.
+ */
+
+#ifndef RC_STATS_H_
+#define RC_STATS_H_
+
+#ifdef RC_ENABLE_STATS
+
+#include <map>
+#include <string>
+#include <ostream>
+
+namespace ReChannel {
+
+/** @brief Hot path counters of the communication layer.
+ *
+ * rc_stats counts rare but costly events on the communication hot
+ * paths:
+ * - FALLBACK_CALL: an accessor forwarded a call to the fallback
+ *   interface (see rc_abstract_accessor::rc_get_fallback_if())
+ * - CANCEL_CONSUMED: an accessor caught and consumed a cancel exception
+ * - DRIVER_WRITE_QUEUED: a driver object queued a write call
+ * - EVENT_SUPPRESSED: an event filter suppressed the forwarding of an
+ *   event (see rc_event_filter::rc_on_event())
+ *
+ * The counts are kept globally and per counting object. Objects may
+ * declare their owner (e.g. a driver object is owned by an interface
+ * wrapper, which is owned by a switch), so that the counts can be
+ * aggregated per switch.
+ *
+ * \remark Use the RC_STATS_* macros instead of calling rc_stats
+ *         directly. They expand to nothing if RC_ENABLE_STATS is not
+ *         defined.
+ */
+class rc_stats
+{
+public:
+    /** @brief The counted events. */
+    enum counter_type {
+        FALLBACK_CALL=0, CANCEL_CONSUMED, DRIVER_WRITE_QUEUED,
+        EVENT_SUPPRESSED
+    };
+
+    /** @brief The number of counters. */
+    enum { COUNTER_COUNT=4 };
+
+    /** @brief A set of counters. */
+    struct counters
+    {
+        counters();
+
+        unsigned long count[COUNTER_COUNT];
+    };
+
+private:
+    typedef std::map<const void*, counters>    object_counters_map;
+    typedef std::map<const void*, const void*> owner_map;
+    typedef std::map<const void*, std::string> switch_map;
+
+public:
+    /** @brief increments a counter of the given object */
+    static inline void inc(const void* obj, counter_type counter);
+
+    /** @brief declares the owner of an object */
+    static void set_owner(const void* obj, const void* owner);
+
+    /** @brief registers a switch as an aggregation target */
+    static void register_switch(
+        const void* switch_obj, const std::string& name);
+
+    /** @brief returns the global count of a counter */
+    static unsigned long get_count(counter_type counter);
+
+    /** @brief returns the count of a counter aggregated for a switch */
+    static unsigned long get_switch_count(
+        const void* switch_obj, counter_type counter);
+
+    /** @brief returns the name of a counter */
+    static const char* get_counter_name(counter_type counter);
+
+    /** @brief writes the global and the per-switch counts */
+    static void dump(std::ostream& os);
+
+    /** @brief resets all counts (the ownership is retained) */
+    static void reset();
+
+private:
+    rc_stats();
+
+    static inline rc_stats& _rc_get_instance();
+
+    const void* _rc_resolve_switch(const void* obj) const;
+
+private:
+    counters            p_global_counters;
+    object_counters_map p_object_counters_map;
+    owner_map           p_owner_map;
+    switch_map          p_switch_map;
+    const void*         p_last_obj;
+    counters*           p_last_counters;
+
+private:
+    // disabled
+    rc_stats(const rc_stats& orig);
+    rc_stats& operator=(const rc_stats& orig);
+};
+
+/* inline code */
+
+inline rc_stats& rc_stats::_rc_get_instance()
+{
+    static rc_stats s_instance;
+    return s_instance;
+}
+
+inline void rc_stats::inc(const void* obj, counter_type counter)
+{
+    rc_stats& stats = _rc_get_instance();
+    ++stats.p_global_counters.count[counter];
+    if (obj != stats.p_last_obj || stats.p_last_counters == NULL) {
+        stats.p_last_counters = &stats.p_object_counters_map[obj];
+        stats.p_last_obj = obj;
+    }
+    ++stats.p_last_counters->count[counter];
+}
+
+} // namespace ReChannel
+
+/**
+ * @brief Increments a counter of an object.
+ * \note The object pointer has to be of the type it was declared with.
+ */
+#define RC_STATS_INC(obj_, counter_) \
+    ::ReChannel::rc_stats::inc( \
+        (const void*)(obj_), ::ReChannel::rc_stats::counter_)
+
+/** @brief Declares the owner of an object. */
+#define RC_STATS_SET_OWNER(obj_, owner_) \
+    ::ReChannel::rc_stats::set_owner( \
+        (const void*)(obj_), (const void*)(owner_))
+
+/** @brief Registers a switch as an aggregation target. */
+#define RC_STATS_REGISTER_SWITCH(switch_, name_) \
+    ::ReChannel::rc_stats::register_switch((const void*)(switch_), name_)
+
+/** @brief Writes the counts to the given stream. */
+#define RC_STATS_DUMP(os_) \
+    ::ReChannel::rc_stats::dump(os_)
+
+#else // !RC_ENABLE_STATS
+
+#define RC_STATS_INC(obj_, counter_)              (void)0
+#define RC_STATS_SET_OWNER(obj_, owner_)          (void)0
+#define RC_STATS_REGISTER_SWITCH(switch_, name_)  (void)0
+#define RC_STATS_DUMP(os_)                        (void)0
+
+#endif // RC_ENABLE_STATS
+
+#endif // RC_STATS_H_
+
+//
+// $Id$
+//
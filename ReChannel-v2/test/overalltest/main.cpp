@@ -32,6 +32,9 @@
  */
 
 #include "main.h"
+#include "regression.h"
+
+int test_failure_count = 0;
 
 int sc_main(int argc, char* argv[])
 {
@@ -41,9 +44,14 @@ int sc_main(int argc, char* argv[])
     TB->clk(clk);
     TB->clk_2(clk);
 
+    regression_tests* RT = new regression_tests("regression");
+
     sc_start(750.0, SC_NS);
-    cout << "done\n";
 
+    RT->check_done();
+    cout << "done (" << test_failure_count << " failed checks)\n";
+
+    delete RT;
     delete TB;
-    return 0;
+    return test_failure_count;
 }
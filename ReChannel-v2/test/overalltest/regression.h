@@ -0,0 +1,1222 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ *
+ */
+/**
+ * @file    regression.h
+ * @brief   Self-checking regression tests
+ *
+ * Every test is a module of its own that reports a failed check by
+ * TEST_CHECK(). sc_main() returns the number of failed checks.
+ */
+
+#ifndef REGRESSION_H_
+#define REGRESSION_H_
+
+#include <ReChannel.h>
+
+/** @brief the number of failed checks */
+extern int test_failure_count;
+
+#define TEST_CHECK(cond_) \
+    if (!(cond_)) { \
+        ++test_failure_count; \
+        RC_COUTL("check failed: " #cond_ \
+            " (line " << __LINE__ << ", t=" << sc_time_stamp() << ")"); \
+    } else (void)0
+
+/*
+ * preemption with a deadline (two modules behind one portal)
+ *
+ * Module A is preempted while its write is blocked in the full static
+ * fifo. B's write completes before A's discarded one and must be
+ * accounted to B, so that B can be deactivated without a deadline.
+ */
+
+SC_MODULE(preempt_writer)
+{
+    sc_fifo_out<int> out;
+
+    sc_event go;
+    int      value;
+
+    SC_CTOR(preempt_writer)
+        : value(0)
+    {
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        while(true) {
+            wait(go);
+            out.write(value);
+        }
+    }
+};
+
+typedef rc_reconfigurable_module<preempt_writer> preempt_writer_rc;
+
+SC_MODULE(preemption_test)
+{
+    sc_fifo<int> fifo;
+
+    rc_portal<sc_fifo_out<int> > pout;
+
+    preempt_writer_rc A;
+    preempt_writer_rc B;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(preemption_test)
+        : fifo(1), A("A"), B("B"), is_done(false)
+    {
+        pout.bind_static(fifo);
+        pout.bind_dynamic(A.out);
+        pout.bind_dynamic(B.out);
+
+        A.value = 1;
+        B.value = 2;
+        A.rc_set_preemption_deadline(sc_time(5, SC_NS));
+
+        ctrl.add(A + B);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        fifo.write(0); // the fifo is full now
+        ctrl.activate(A);
+        A.go.notify();
+        wait(1, SC_NS);
+        TEST_CHECK(A.rc_get_transaction_count() == 1);
+
+        // A is preempted after 5 ns
+        const sc_time t0 = sc_time_stamp();
+        ctrl.deactivate(A);
+        TEST_CHECK(sc_time_stamp() - t0 <= sc_time(6, SC_NS));
+        TEST_CHECK(A.rc_get_preemption_count() == 1);
+        TEST_CHECK(A.rc_get_transaction_count() == 0);
+
+        // B is shadow loaded and takes over the portal
+        ctrl.activate(B);
+
+        // B writes in the current delta, A's write is woken afterwards
+        //   and blocks again
+        TEST_CHECK(fifo.read() == 0);
+        B.go.notify();
+        wait(1, SC_NS);
+        TEST_CHECK(B.rc_get_transaction_count() == 0);
+        TEST_CHECK(A.rc_get_preemption_latency_saved() == SC_ZERO_TIME);
+
+        // B has no pending transactions and no deadline
+        const sc_time t1 = sc_time_stamp();
+        ctrl.deactivate(B);
+        TEST_CHECK(sc_time_stamp() - t1 < sc_time(1, SC_NS));
+        TEST_CHECK(B.rc_get_preemption_count() == 0);
+
+        // the discarded write of A completes
+        TEST_CHECK(fifo.read() == 2);
+        wait(1, SC_NS);
+        TEST_CHECK(fifo.read() == 1);
+        TEST_CHECK(A.rc_get_preemption_latency_saved() > SC_ZERO_TIME);
+        TEST_CHECK(A.rc_get_transaction_count() == 0);
+
+        RC_COUTL("preemption_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * shadow loading and swap
+ *
+ * B is loaded while A is still active on the same portal. A keeps on
+ * communicating during B's load delay, and the swap only takes the
+ * activation of B.
+ */
+
+SC_MODULE(shadow_swap_test)
+{
+    sc_fifo<int> fifo;
+
+    rc_portal<sc_fifo_out<int> > pout;
+
+    preempt_writer_rc A;
+    preempt_writer_rc B;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(shadow_swap_test)
+        : fifo(4), A("A"), B("B"), is_done(false)
+    {
+        pout.bind_static(fifo);
+        pout.bind_dynamic(A.out);
+        pout.bind_dynamic(B.out);
+
+        A.value = 1;
+        B.value = 2;
+        B.rc_set_default_delay(RC_LOAD, sc_time(10, SC_NS));
+
+        ctrl.add(A + B);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        ctrl.activate(A);
+
+        // A writes in the middle of B's load
+        A.go.notify(5, SC_NS);
+        const sc_time t0 = sc_time_stamp();
+        ctrl.load(B);
+        TEST_CHECK(sc_time_stamp() - t0 >= sc_time(10, SC_NS));
+        TEST_CHECK(A.rc_is_active());
+        TEST_CHECK(B.rc_get_state() == rc_reconfigurable::INACTIVE);
+        TEST_CHECK(fifo.num_available() == 1);
+        TEST_CHECK(fifo.read() == 1);
+
+        // swap (B is already loaded)
+        ctrl.deactivate(A);
+        const sc_time t1 = sc_time_stamp();
+        ctrl.activate(B);
+        TEST_CHECK(sc_time_stamp() - t1 < sc_time(10, SC_NS));
+        TEST_CHECK(A.rc_is_loaded() && !A.rc_is_active());
+        TEST_CHECK(B.rc_is_active());
+
+        B.go.notify();
+        wait(1, SC_NS);
+        TEST_CHECK(fifo.num_available() == 1);
+        TEST_CHECK(fifo.read() == 2);
+
+        RC_COUTL("shadow_swap_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * context save/restore
+ *
+ * Each run of the thread increments the signal. A preserved context
+ * survives the deactivation, a reset or an unload discards it.
+ */
+
+RC_RECONFIGURABLE_MODULE(context_module)
+{
+    rc_signal<int> sig;
+
+    RC_RECONFIGURABLE_CTOR(context_module)
+    {
+        RC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        sig = sig.read() + 1;
+    }
+};
+
+SC_MODULE(context_test)
+{
+    context_module C;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(context_test)
+        : C("C"), is_done(false)
+    {
+        ctrl.add(C);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        C.rc_set_context_preserving(true);
+        ctrl.activate(C);
+        wait(1, SC_NS);
+        TEST_CHECK(C.sig.read() == 1);
+
+        ctrl.deactivate(C);
+        TEST_CHECK(C.rc_has_saved_context());
+        ctrl.activate(C);
+        TEST_CHECK(!C.rc_has_saved_context());
+        wait(1, SC_NS);
+        TEST_CHECK(C.sig.read() == 2);
+
+        // the context is reset if it is not preserved
+        C.rc_set_context_preserving(false);
+        ctrl.deactivate(C);
+        TEST_CHECK(!C.rc_has_saved_context());
+        ctrl.activate(C);
+        wait(1, SC_NS);
+        TEST_CHECK(C.sig.read() == 1);
+
+        // unloading discards a saved context
+        C.rc_set_context_preserving(true);
+        ctrl.deactivate(C);
+        TEST_CHECK(C.rc_has_saved_context());
+        ctrl.unload(C);
+        TEST_CHECK(!C.rc_has_saved_context());
+        ctrl.activate(C);
+        wait(1, SC_NS);
+        TEST_CHECK(C.sig.read() == 1);
+
+        RC_COUTL("context_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * dirty-tracked reset
+ *
+ * A dirty-tracked resettable is only reset if it has been modified
+ * since its last reset, an untracked one on every reset.
+ */
+
+class reset_counter
+    : public rc_resettable
+{
+public:
+    explicit reset_counter(bool is_tracking)
+        : value(0), reset_count(0), p_is_tracking(is_tracking)
+        { }
+
+    void set(int value_)
+    {
+        value = value_;
+        this->rc_set_dirty();
+    }
+
+    int value;
+    int reset_count;
+
+protected:
+    RC_ON_INIT_RESETTABLE() { }
+
+    RC_ON_RESET()
+    {
+        value = 0;
+        ++reset_count;
+    }
+
+    virtual bool rc_is_dirty_tracking() const
+        { return p_is_tracking; }
+
+private:
+    bool p_is_tracking;
+};
+
+RC_RECONFIGURABLE_MODULE(dirty_module)
+{
+    reset_counter tracked;
+    reset_counter untracked;
+
+    RC_RECONFIGURABLE_CTOR(dirty_module),
+        tracked(true), untracked(false)
+    {
+        this->rc_register_resettable(tracked);
+        this->rc_register_resettable(untracked);
+    }
+};
+
+SC_MODULE(dirty_reset_test)
+{
+    dirty_module D;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(dirty_reset_test)
+        : D("D"), is_done(false)
+    {
+        ctrl.add(D);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        ctrl.activate(D);
+        const int untracked_count = D.untracked.reset_count;
+        TEST_CHECK(untracked_count > 0);
+        TEST_CHECK(D.tracked.reset_count == 0);
+
+        ctrl.deactivate(D);
+        TEST_CHECK(D.untracked.reset_count > untracked_count);
+        TEST_CHECK(D.tracked.reset_count == 0);
+
+        ctrl.activate(D);
+        D.tracked.set(5);
+        ctrl.deactivate(D);
+        TEST_CHECK(D.tracked.reset_count == 1);
+        TEST_CHECK(D.tracked.value == 0);
+
+        ctrl.activate(D);
+        TEST_CHECK(D.tracked.reset_count == 1);
+
+        RC_COUTL("dirty_reset_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * epoch cancellation
+ *
+ * The deactivation cancels the thread, the method and the spawned
+ * thread of the module by a single epoch change. None of them reacts
+ * to the trigger while the module is inactive.
+ */
+
+RC_RECONFIGURABLE_MODULE(cancel_module)
+{
+    sc_event trigger;
+
+    rc_process_handle hspawned;
+
+    int thread_runs;
+    int thread_wakeups;
+    int method_runs;
+    int spawned_wakeups;
+
+    RC_RECONFIGURABLE_CTOR(cancel_module),
+        thread_runs(0), thread_wakeups(0), method_runs(0),
+        spawned_wakeups(0)
+    {
+        RC_THREAD(thread_proc);
+
+        RC_METHOD(method_proc);
+        sensitive << trigger;
+        dont_initialize();
+    }
+
+    void thread_proc()
+    {
+        ++thread_runs;
+        hspawned = rc_spawn(rc_bind(&cancel_module::spawned_proc, this));
+        while(true) {
+            wait(trigger);
+            ++thread_wakeups;
+        }
+    }
+
+    void method_proc()
+    {
+        ++method_runs;
+    }
+
+    void spawned_proc()
+    {
+        while(true) {
+            wait(trigger);
+            ++spawned_wakeups;
+        }
+    }
+};
+
+SC_MODULE(cancel_test)
+{
+    cancel_module E;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(cancel_test)
+        : E("E"), is_done(false)
+    {
+        ctrl.add(E);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        ctrl.activate(E);
+        wait(1, SC_NS);
+        TEST_CHECK(E.thread_runs == 1);
+        TEST_CHECK(!E.hspawned.terminated());
+
+        E.trigger.notify();
+        wait(1, SC_NS);
+        TEST_CHECK(E.thread_wakeups == 1);
+        TEST_CHECK(E.method_runs == 1);
+        TEST_CHECK(E.spawned_wakeups == 1);
+
+        const rc_process_handle hspawned = E.hspawned;
+        ctrl.deactivate(E);
+        TEST_CHECK(hspawned.is_canceled());
+
+        E.trigger.notify();
+        wait(1, SC_NS);
+        TEST_CHECK(E.thread_wakeups == 1);
+        TEST_CHECK(E.method_runs == 1);
+        TEST_CHECK(E.spawned_wakeups == 1);
+        TEST_CHECK(hspawned.terminated());
+
+        // the thread restarts and spawns a new thread
+        ctrl.activate(E);
+        wait(1, SC_NS);
+        TEST_CHECK(E.thread_runs == 2);
+        TEST_CHECK(E.hspawned != hspawned);
+
+        E.trigger.notify();
+        wait(1, SC_NS);
+        TEST_CHECK(E.thread_wakeups == 2);
+        TEST_CHECK(E.method_runs == 2);
+        TEST_CHECK(E.spawned_wakeups == 2);
+
+        RC_COUTL("cancel_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * idle-worker reuse
+ *
+ * An unnamed spawned thread is reused once its handle has been
+ * released, and its reused entry reports termination as a fresh one.
+ */
+
+RC_RECONFIGURABLE_MODULE(worker_module)
+{
+    bool is_done;
+
+    RC_RECONFIGURABLE_CTOR(worker_module),
+        is_done(false)
+    {
+        RC_THREAD(proc);
+    }
+
+    void job()
+    {
+        wait(1, SC_NS);
+    }
+
+    void proc()
+    {
+        rc_process_handle hproc =
+            rc_spawn(rc_bind(&worker_module::job, this));
+        sc_object* const worker = hproc.get_process_object();
+        wait(hproc.terminated_event());
+        TEST_CHECK(hproc.terminated());
+
+        // release the handle, the worker may be reused now
+        hproc = rc_process_handle();
+        hproc = rc_spawn(rc_bind(&worker_module::job, this));
+#if RC_PROCESS_POOL_SIZE > 0
+        TEST_CHECK(hproc.get_process_object() == worker);
+#endif // RC_PROCESS_POOL_SIZE > 0
+        TEST_CHECK(!hproc.terminated());
+        wait(hproc.terminated_event());
+        TEST_CHECK(hproc.terminated());
+
+        is_done = true;
+    }
+};
+
+SC_MODULE(worker_test)
+{
+    worker_module W;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(worker_test)
+        : W("W"), is_done(false)
+    {
+        ctrl.add(W);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        ctrl.activate(W);
+        wait(10, SC_NS);
+        TEST_CHECK(W.is_done);
+
+        RC_COUTL("worker_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * registry reclamation
+ *
+ * The entries of named spawned threads are reclaimed after they have
+ * terminated and their handles have been released.
+ */
+
+RC_RECONFIGURABLE_MODULE(registry_module)
+{
+    bool is_done;
+
+    RC_RECONFIGURABLE_CTOR(registry_module),
+        is_done(false)
+    {
+        RC_THREAD(proc);
+    }
+
+    void job()
+    {
+        wait(1, SC_NS);
+    }
+
+    void proc()
+    {
+        rc_process_registry& preg = rc_get_process_registry();
+        preg.gc();
+        const unsigned int process_count = preg.get_process_count();
+        for (int i=0; i < 32; i++) {
+            rc_process_handle hproc = rc_spawn(
+                rc_bind(&registry_module::job, this),
+                sc_gen_unique_name("job"));
+            wait(hproc.terminated_event());
+        }
+        // let the last thread terminate physically
+        wait(SC_ZERO_TIME);
+        preg.gc();
+        TEST_CHECK(preg.get_process_count() <= process_count);
+
+        is_done = true;
+    }
+};
+
+SC_MODULE(registry_test)
+{
+    registry_module R;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(registry_test)
+        : R("R"), is_done(false)
+    {
+        ctrl.add(R);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        ctrl.activate(R);
+        wait(100, SC_NS);
+        TEST_CHECK(R.is_done);
+
+        RC_COUTL("registry_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * placeholder body lifetime
+ *
+ * The body of a placeholder is constructed on its first load and, if
+ * requested, destroyed on unload. A body loaded during elaboration is
+ * constructed as soon as the simulation is running.
+ */
+
+class counting_body;
+
+typedef rc_reconfigurable_placeholder<counting_body> counting_placeholder;
+
+class counting_body
+    : public rc_placeholder_body,
+      public rc_resettable
+{
+public:
+    explicit counting_body(counting_placeholder& placeholder)
+        : load_count(0), activate_count(0), reset_count(0)
+        { ++s_instance_count; }
+
+    virtual ~counting_body()
+        { --s_instance_count; }
+
+    int load_count;
+    int activate_count;
+    int reset_count;
+
+    static int s_instance_count;
+
+protected:
+    virtual void rc_on_load()
+        { ++load_count; }
+
+    virtual void rc_on_activate()
+        { ++activate_count; }
+
+    RC_ON_INIT_RESETTABLE() { }
+
+    RC_ON_RESET()
+        { ++reset_count; }
+};
+
+int counting_body::s_instance_count = 0;
+
+SC_MODULE(placeholder_test)
+{
+    counting_placeholder P;
+    counting_placeholder Q;
+
+    reset_counter resettable;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(placeholder_test)
+        : P("P", true), Q("Q"), resettable(false), is_done(false)
+    {
+        ctrl.add(P + Q);
+
+        // loaded during elaboration
+        ctrl.activate(Q);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        wait(1, SC_NS);
+        // the body of Q has been constructed by the elaboration load
+        TEST_CHECK(Q.rc_has_body());
+        TEST_CHECK(Q.rc_get_body_construction_count() == 1);
+        TEST_CHECK(Q.rc_get_body()->load_count == 1);
+        TEST_CHECK(Q.rc_get_body()->activate_count == 1);
+        TEST_CHECK(Q.rc_is_registered(*Q.rc_get_body()));
+        const int instance_count = counting_body::s_instance_count;
+
+        // construct on first load
+        TEST_CHECK(!P.rc_has_body());
+        ctrl.load(P);
+        TEST_CHECK(P.rc_has_body());
+        TEST_CHECK(P.rc_get_body_construction_count() == 1);
+        TEST_CHECK(counting_body::s_instance_count == instance_count + 1);
+        counting_body* const body = P.rc_get_body();
+        TEST_CHECK(body->load_count == 1);
+        TEST_CHECK(P.rc_is_registered(*body));
+
+        ctrl.activate(P);
+        TEST_CHECK(body->activate_count == 1);
+        ctrl.deactivate(P);
+        TEST_CHECK(body->reset_count > 0);
+
+        // destroy on unload
+        ctrl.unload(P);
+        TEST_CHECK(!P.rc_has_body());
+        TEST_CHECK(counting_body::s_instance_count == instance_count);
+
+        ctrl.load(P);
+        TEST_CHECK(P.rc_get_body_construction_count() == 2);
+        TEST_CHECK(P.rc_get_body()->load_count == 1);
+
+        // an unregistered resettable is no longer reset
+        P.rc_register_resettable(resettable);
+        TEST_CHECK(P.rc_is_registered(resettable));
+        ctrl.activate(P);
+        ctrl.deactivate(P);
+        const int reset_count = resettable.reset_count;
+        TEST_CHECK(reset_count > 0);
+        P.rc_unregister_resettable(resettable);
+        TEST_CHECK(!P.rc_is_registered(resettable));
+        ctrl.activate(P);
+        ctrl.deactivate(P);
+        TEST_CHECK(resettable.reset_count == reset_count);
+        ctrl.unload(P);
+
+        RC_COUTL("placeholder_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * resettable block
+ *
+ * The reset image of a block is captured at the start of simulation.
+ * A reset restores it, a preserved context survives the deactivation.
+ */
+
+struct block_regs
+{
+    int ctrl;
+    int lut[4];
+};
+
+RC_RECONFIGURABLE_MODULE(block_module)
+{
+    rc_resettable_block<block_regs> regs;
+
+    RC_RECONFIGURABLE_CTOR(block_module)
+    {
+        // written during elaboration, i.e. part of the reset image
+        regs->ctrl = 7;
+        regs->lut[3] = 9;
+    }
+};
+
+SC_MODULE(block_test)
+{
+    block_module B;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(block_test)
+        : B("B"), is_done(false)
+    {
+        ctrl.add(B);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        TEST_CHECK(B.rc_is_registered(B.regs));
+        TEST_CHECK(B.regs.get_reset_value().ctrl == 7);
+        TEST_CHECK(B.regs.get_reset_value().lut[3] == 9);
+
+        ctrl.activate(B);
+        TEST_CHECK(B.regs->ctrl == 7);
+        B.regs->ctrl = 3;
+        B.regs->lut[3] = 1;
+
+        // a reset restores the reset image
+        ctrl.deactivate(B);
+        TEST_CHECK(B.regs->ctrl == 7);
+        TEST_CHECK(B.regs->lut[3] == 9);
+
+        // a preserved context is restored on activation
+        ctrl.activate(B);
+        B.regs->ctrl = 5;
+        B.regs->lut[0] = 2;
+        B.rc_set_context_preserving(true);
+        ctrl.deactivate(B);
+        TEST_CHECK(B.rc_has_saved_context());
+        ctrl.activate(B);
+        TEST_CHECK(B.regs->ctrl == 5);
+        TEST_CHECK(B.regs->lut[0] == 2);
+        TEST_CHECK(B.regs->lut[3] == 9);
+        TEST_CHECK(B.regs.get_reset_value().ctrl == 7);
+
+        RC_COUTL("block_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * copy-on-write memory
+ *
+ * Pages are copied from the reset image on their first write, a reset
+ * drops them. Words written during elaboration are folded into the
+ * reset image, writes are dropped while the memory is inactive.
+ */
+
+RC_RECONFIGURABLE_MODULE(memory_module)
+{
+    int image[64];
+
+    rc_memory<int> mem;
+
+    RC_RECONFIGURABLE_CTOR(memory_module),
+        mem("mem", image, 64, 16)
+    {
+        for (int i=0; i < 64; i++) {
+            image[i] = i;
+        }
+        // written during elaboration
+        mem.write(20, 100);
+    }
+};
+
+SC_MODULE(memory_test)
+{
+    memory_module M;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(memory_test)
+        : M("M"), is_done(false)
+    {
+        ctrl.add(M);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        rc_memory<int>& mem = M.mem;
+
+        // the elaboration write has been folded into the reset image
+        TEST_CHECK(mem.get_dirty_page_count() == 0);
+        TEST_CHECK(mem.read(20) == 100);
+        TEST_CHECK(mem.get_reset_image()[20] == 100);
+        TEST_CHECK(M.image[20] == 20);
+
+        // writes are dropped while the memory is inactive
+        ctrl.load(M);
+        mem.write(5, 55);
+        TEST_CHECK(mem.read(5) == 5);
+        TEST_CHECK(mem.get_dirty_page_count() == 0);
+        unsigned int count = 1;
+        TEST_CHECK(mem.get_write_ptr(5, count) == NULL);
+        TEST_CHECK(count == 0);
+
+        // copy on write
+        ctrl.activate(M);
+        mem.write(5, 55);
+        TEST_CHECK(mem.get_dirty_page_count() == 1);
+        TEST_CHECK(mem.read(5) == 55);
+        TEST_CHECK(mem.read(6) == 6);
+        TEST_CHECK(mem.get_reset_image()[5] == 5);
+        const int data[3] = { 1, 2, 3 };
+        mem.burst_write(15, data, 3);
+        TEST_CHECK(mem.get_dirty_page_count() == 2);
+        TEST_CHECK(mem.read(17) == 3);
+        TEST_CHECK(mem.read(20) == 100);
+
+        // a reset drops the modified pages
+        ctrl.deactivate(M);
+        TEST_CHECK(mem.get_dirty_page_count() == 0);
+        TEST_CHECK(mem.read(5) == 5);
+        TEST_CHECK(mem.read(17) == 17);
+        TEST_CHECK(mem.read(20) == 100);
+
+        RC_COUTL("memory_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * edge sensitivity
+ *
+ * sensitive_pos and sensitive_neg refer to the process declared last,
+ * which is named after its member function.
+ */
+
+RC_RECONFIGURABLE_MODULE(edge_module)
+{
+    sc_in<bool> clk;
+
+    int pos_count;
+    int neg_count;
+
+    std::string pos_name;
+
+    RC_RECONFIGURABLE_CTOR(edge_module),
+        pos_count(0), neg_count(0)
+    {
+        RC_METHOD(pos_proc);
+        sensitive_pos << clk;
+        dont_initialize();
+
+        RC_METHOD(neg_proc);
+        sensitive_neg << clk;
+        dont_initialize();
+    }
+
+    void pos_proc()
+    {
+        ++pos_count;
+        pos_name =
+            sc_get_current_process_handle().get_process_object()->basename();
+    }
+
+    void neg_proc()
+    {
+        ++neg_count;
+    }
+};
+
+SC_MODULE(edge_test)
+{
+    edge_module G;
+
+    sc_signal<bool> clk;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(edge_test)
+        : G("G"), is_done(false)
+    {
+        G.clk(clk);
+
+        ctrl.add(G);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        ctrl.activate(G);
+        wait(1, SC_NS);
+        const int pos_count = G.pos_count;
+        const int neg_count = G.neg_count;
+
+        clk = true;
+        wait(1, SC_NS);
+        TEST_CHECK(G.pos_count == pos_count + 1);
+        TEST_CHECK(G.neg_count == neg_count);
+        TEST_CHECK(G.pos_name == "pos_proc");
+
+        clk = false;
+        wait(1, SC_NS);
+        TEST_CHECK(G.pos_count == pos_count + 1);
+        TEST_CHECK(G.neg_count == neg_count + 1);
+
+        RC_COUTL("edge_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * stackless thread across reset
+ *
+ * A reset restarts the body of a stackless thread at
+ * RC_STACKLESS_BEGIN. Two wait statements on the same line have
+ * distinct resume points.
+ */
+
+RC_RECONFIGURABLE_MODULE(stackless_module)
+{
+    sc_event trigger;
+
+    int begin_count;
+    int step;
+
+    RC_RECONFIGURABLE_CTOR(stackless_module),
+        begin_count(0), step(0)
+    {
+        RC_STACKLESS_THREAD(proc);
+    }
+
+    void proc()
+    {
+        RC_STACKLESS_BEGIN;
+        ++begin_count;
+        step = 0;
+        while(true) {
+            RC_STACKLESS_WAIT(trigger);
+            ++step;
+#ifdef __COUNTER__
+            RC_STACKLESS_WAIT(trigger); ++step; RC_STACKLESS_WAIT(trigger);
+#else
+            RC_STACKLESS_WAIT(trigger);
+            ++step;
+            RC_STACKLESS_WAIT(trigger);
+#endif // __COUNTER__
+            step = 0;
+        }
+        RC_STACKLESS_END;
+    }
+};
+
+SC_MODULE(stackless_test)
+{
+    stackless_module S;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(stackless_test)
+        : S("S"), is_done(false)
+    {
+        ctrl.add(S);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        ctrl.activate(S);
+        wait(1, SC_NS);
+        TEST_CHECK(S.begin_count == 1);
+        TEST_CHECK(S.step == 0);
+
+        S.trigger.notify();
+        wait(1, SC_NS);
+        TEST_CHECK(S.step == 1);
+        S.trigger.notify();
+        wait(1, SC_NS);
+        TEST_CHECK(S.step == 2);
+
+        // the reset restarts the body
+        ctrl.deactivate(S);
+        ctrl.activate(S);
+        wait(1, SC_NS);
+        TEST_CHECK(S.begin_count == 2);
+        TEST_CHECK(S.step == 0);
+
+        S.trigger.notify();
+        wait(1, SC_NS);
+        TEST_CHECK(S.step == 1);
+        S.trigger.notify();
+        wait(1, SC_NS);
+        S.trigger.notify();
+        wait(1, SC_NS);
+        TEST_CHECK(S.step == 0);
+        TEST_CHECK(S.begin_count == 2);
+
+        RC_COUTL("stackless_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * temporally decoupled reconfiguration
+ *
+ * The delays of a set of decoupled modules are reconfigured in parallel
+ * processes, whose local time offsets are handed over to the caller.
+ */
+
+RC_RECONFIGURABLE_MODULE(decoupled_module)
+{
+    RC_RECONFIGURABLE_CTOR(decoupled_module)
+    {
+        this->rc_set_temporal_decoupling(true);
+        this->rc_set_default_delay(RC_LOAD, sc_time(10, SC_NS));
+        this->rc_set_default_delay(RC_UNLOAD, sc_time(5, SC_NS));
+    }
+};
+
+SC_MODULE(decoupling_test)
+{
+    decoupled_module A;
+    decoupled_module B;
+    decoupled_module C;
+
+    rc_control ctrl;
+
+    bool is_done;
+
+    SC_CTOR(decoupling_test)
+        : A("A"), B("B"), C("C"), is_done(false)
+    {
+        ctrl.add(A + B + C);
+
+        SC_THREAD(proc);
+    }
+
+    void proc()
+    {
+        rc_local_time::set_global_quantum(sc_time(1, SC_US));
+        const sc_time start = sc_time_stamp();
+
+        // the delays of the parallel loads are not lost
+        sc_time offset = SC_ZERO_TIME;
+        ctrl.load(A + B + C, offset);
+        TEST_CHECK(offset == sc_time(10, SC_NS));
+        TEST_CHECK(sc_time_stamp() == start);
+        TEST_CHECK(A.rc_is_loaded() && B.rc_is_loaded() && C.rc_is_loaded());
+
+        ctrl.unload(A + B, offset);
+        TEST_CHECK(offset == sc_time(15, SC_NS));
+        TEST_CHECK(sc_time_stamp() == start);
+        TEST_CHECK(!A.rc_is_loaded() && !B.rc_is_loaded());
+
+        // the offset of the calling process itself
+        ctrl.unload(C);
+        TEST_CHECK(rc_local_time::get_offset() == sc_time(5, SC_NS));
+        TEST_CHECK(!C.rc_is_loaded());
+        // the consumed offset is recorded as the delay
+        TEST_CHECK(C.rc_get_last_phase_record().phase_time[
+            rc_phase_record::DELAY_PHASE] == sc_time(5, SC_NS));
+        rc_local_time::sync(offset);
+        TEST_CHECK(sc_time_stamp() == start + sc_time(20, SC_NS));
+
+        rc_local_time::set_global_quantum(SC_ZERO_TIME);
+
+        RC_COUTL("decoupling_test: done (t=" << sc_time_stamp() << ")");
+        is_done = true;
+    }
+};
+
+/*
+ * all tests
+ */
+
+SC_MODULE(regression_tests)
+{
+    preemption_test  preemption;
+    shadow_swap_test shadow_swap;
+    context_test     context;
+    dirty_reset_test dirty_reset;
+    cancel_test      cancel;
+    worker_test      worker;
+    registry_test    registry;
+    placeholder_test placeholder;
+    block_test       block;
+    memory_test      memory;
+    edge_test        edge;
+    stackless_test   stackless;
+    decoupling_test  decoupling;
+
+    SC_CTOR(regression_tests)
+        : preemption("preemption_test"), shadow_swap("shadow_swap_test"),
+          context("context_test"), dirty_reset("dirty_reset_test"),
+          cancel("cancel_test"), worker("worker_test"),
+          registry("registry_test"), placeholder("placeholder_test"),
+          block("block_test"), memory("memory_test"),
+          edge("edge_test"), stackless("stackless_test"),
+          decoupling("decoupling_test")
+    { }
+
+    // checks that all tests have run to completion
+    void check_done() const
+    {
+        TEST_CHECK(preemption.is_done);
+        TEST_CHECK(shadow_swap.is_done);
+        TEST_CHECK(context.is_done);
+        TEST_CHECK(dirty_reset.is_done);
+        TEST_CHECK(cancel.is_done);
+        TEST_CHECK(worker.is_done);
+        TEST_CHECK(registry.is_done);
+        TEST_CHECK(placeholder.is_done);
+        TEST_CHECK(block.is_done);
+        TEST_CHECK(memory.is_done);
+        TEST_CHECK(edge.is_done);
+        TEST_CHECK(stackless.is_done);
+        TEST_CHECK(decoupling.is_done);
+    }
+};
+
+#endif // REGRESSION_H_
+
+//
+// $Id$
+//
@@ -0,0 +1,164 @@
+// vim:set et sts=4 ts=4 tw=75 sw=4 ai ci cin cino=g0,t0:
+/*
+ * Copyright (C) 2007, Technical Computer Science Group,
+ *                     University of Bonn
+ *
+ * This file is part of the ReChannel library.
+ *
+ * The ReChannel library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this library; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * @file    main.cpp
+ * @brief   Converts a ReChannel trace file to the Chrome trace format.
+ *
+ * The output can be loaded into chrome://tracing or the Perfetto UI.
+ * Every traced object is shown as a thread of its own. Timestamps are
+ * taken from the simulation time, or from the wall-clock time if
+ * option --wall is given.
+ *
+ * Usage: rc_trace2json [--wall] <trace file> [<json file>]
+ */
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "ReChannel/core/rc_trace_format.h"
+
+using namespace ReChannel;
+
+// writes the string as a JSON string literal
+static void write_json_string(std::ostream& out, const std::string& str)
+{
+    out << '"';
+    for (std::string::size_type i=0; i < str.size(); ++i) {
+        const char c = str[i];
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if ((unsigned char)c < 0x20) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+static bool convert(std::istream& in, std::ostream& out, bool use_wall)
+{
+    trace_format::header header;
+    in.read((char*)&header, sizeof(header));
+    if (!in || std::memcmp(header.magic, trace_format::magic, 8) != 0) {
+        std::cerr << "error: not a ReChannel trace file" << std::endl;
+        return false;
+    }
+    // microseconds per simulation time unit
+    const double sim_time_scale = header.time_resolution * 1e6;
+
+    out.precision(15);
+    out << "{\"traceEvents\":[" << std::endl;
+    bool is_first = true;
+    char kind;
+    while (in.read(&kind, 1)) {
+        if (kind == trace_format::CHUNK_OBJECT) {
+            boost::uint32_t id, length;
+            in.read((char*)&id, sizeof(id));
+            in.read((char*)&length, sizeof(length));
+            std::string name(length, ' ');
+            if (length > 0) {
+                in.read(&name[0], length);
+            }
+            if (!in) {
+                break;
+            }
+            out << (is_first ? "" : ",\n")
+                << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                << "\"tid\":" << id << ",\"args\":{\"name\":";
+            write_json_string(out, name);
+            out << "}}";
+            is_first = false;
+        } else if (kind == trace_format::CHUNK_RECORDS) {
+            boost::uint32_t count;
+            in.read((char*)&count, sizeof(count));
+            for (boost::uint32_t i=0; i < count && in; ++i) {
+                trace_format::record rec;
+                in.read((char*)&rec, sizeof(rec));
+                if (!in) {
+                    break;
+                }
+                const double ts = (use_wall
+                    ? rec.wall_time / 1000.0
+                    : rec.sim_time * sim_time_scale);
+                out << (is_first ? "" : ",\n")
+                    << "{\"name\":\""
+                    << trace_format::get_action_name(rec.action)
+                    << "\",\"cat\":\"rechannel\",\"ph\":\""
+                    << (char)rec.phase << "\",\"ts\":" << ts
+                    << ",\"pid\":1,\"tid\":" << rec.object_id;
+                if (rec.phase == trace_format::INSTANT) {
+                    out << ",\"s\":\"t\"";
+                }
+                out << ",\"args\":{\"delta\":" << rec.delta_count
+                    << ",\"sim_time\":" << rec.sim_time * sim_time_scale
+                    << ",\"wall_time\":" << rec.wall_time / 1000.0
+                    << "}}";
+                is_first = false;
+            }
+        } else {
+            std::cerr << "error: invalid chunk kind "
+                      << (int)kind << std::endl;
+            return false;
+        }
+    }
+    out << std::endl << "]}" << std::endl;
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    bool use_wall = false;
+    int arg = 1;
+    if (arg < argc && std::strcmp(argv[arg], "--wall") == 0) {
+        use_wall = true;
+        ++arg;
+    }
+    if (arg >= argc) {
+        std::cerr << "usage: rc_trace2json [--wall]"
+                     " <trace file> [<json file>]" << std::endl;
+        return 1;
+    }
+    std::ifstream in(argv[arg], std::ios::in | std::ios::binary);
+    if (!in) {
+        std::cerr << "error: cannot open '" << argv[arg] << "'" << std::endl;
+        return 1;
+    }
+    ++arg;
+    if (arg < argc) {
+        std::ofstream out(argv[arg]);
+        if (!out) {
+            std::cerr << "error: cannot open '" << argv[arg] << "'"
+                      << std::endl;
+            return 1;
+        }
+        return (convert(in, out, use_wall) ? 0 : 1);
+    }
+    return (convert(in, std::cout, use_wall) ? 0 : 1);
+}
+
+//
+// $Id$
+//